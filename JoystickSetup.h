@@ -0,0 +1,77 @@
+#ifndef JOYSTICK_SETUP_H
+#define JOYSTICK_SETUP_H
+
+#include "PacMan/Input.h"
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// ============= CALIBRACIÓN DEL JOYSTICK =============
+// Se entra manteniendo A+B al arrancar. Con el joystick suelto se mide el
+// centro y el ruido; girándolo hasta los topes, el recorrido. Se guarda en
+// NVS y la usan tanto el lanzador como los juegos.
+//
+// Aparte del .ino para que tests/host la compile y la ejecute.
+inline void calibrateJoystick(TFT_eSPI &tft, Input &input) {
+  const int cx = tft.width() / 2;
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setTextDatum(MC_DATUM);
+  tft.drawString("Calibrar joystick", cx, 40, 4);
+  tft.drawString("Suelta el joystick y los botones", cx, 100, 2);
+
+  while (!digitalRead(BUTTON_A_PIN) || !digitalRead(BUTTON_B_PIN))
+    delay(10);
+  delay(500); // Que el joystick vuelva al centro
+
+  JoystickCalibrator calibrator;
+  int x, y;
+  for (int i = 0; i < 200; i++) { // 1 s en reposo
+    input.poll(); // Muestrea si no hay tarea de entrada
+    input.getJoystickRaw(x, y);
+    calibrator.sampleRest(x, y);
+    delay(5);
+  }
+
+  tft.fillRect(0, 85, tft.width(), 30, TFT_BLACK);
+  tft.drawString("Gira el joystick hasta los topes", cx, 100, 2);
+  tft.drawString("y pulsa A para guardar", cx, 120, 2);
+
+  // Punto en vivo dentro de un recuadro de 4096 / 32 = 128 px
+  const int boxX = cx - 64, boxY = 160;
+  tft.drawRect(boxX - 1, boxY - 1, 130, 130, TFT_DARKGREY);
+  int dotX = -1, dotY = -1;
+  input.poll(); // Descartar las pulsaciones de A+B
+  do {
+    input.poll();
+    input.getJoystickRaw(x, y);
+    calibrator.sampleTravel(x, y);
+    if (x / 32 != dotX || y / 32 != dotY) {
+      if (dotX >= 0)
+        tft.fillRect(boxX + dotX - 2, boxY + dotY - 2, 5, 5, TFT_BLACK);
+      dotX = x / 32;
+      dotY = y / 32;
+      tft.fillRect(boxX + dotX - 2, boxY + dotY - 2, 5, 5, TFT_YELLOW);
+    }
+    delay(5);
+  } while (!input.getButtons().aJustPressed);
+
+  tft.fillRect(0, 85, tft.width(), tft.height() - 85, TFT_BLACK);
+  JoystickCalibration cal;
+  if (!calibrator.result(cal)) {
+    Serial.println("Calibración descartada: recorrido insuficiente");
+    tft.drawString("Recorrido insuficiente,", cx, 140, 2);
+    tft.drawString("se mantiene la calibración anterior", cx, 160, 2);
+  } else if (input.saveCalibration(cal)) {
+    Serial.printf("Joystick: centro %u,%u X %u-%u Y %u-%u zona muerta %u\n",
+                  cal.centerX, cal.centerY, cal.minX, cal.maxX, cal.minY,
+                  cal.maxY, cal.deadzone);
+    tft.drawString("Calibración guardada", cx, 150, 2);
+  } else {
+    Serial.println("ERROR: No se pudo guardar la calibración");
+    tft.drawString("Error al guardar", cx, 150, 2);
+  }
+  delay(1500);
+  tft.fillScreen(TFT_BLACK);
+}
+
+#endif
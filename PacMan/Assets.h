@@ -32,6 +32,25 @@
 #define C_GREY 0x8410
 #define C_DKGR 0x2104
 
+// Skins and themes are palettes indexed by the shop item; adding one is a
+// new entry here (and in the shop)
+const uint16_t pacman_skin_colors[8] = {C_YELL, C_PINK, C_CYAN, C_GREN,
+                                        0xF800, 0x07E0, 0x001F, 0xFFFF};
+
+struct MazeTheme {
+  uint16_t wall;      // Tile outline
+  uint16_t wallInner; // Tile fill
+};
+const MazeTheme maze_themes[4] = {
+    {C_BLUE, 0x0010}, // Classic
+    {0xD820, 0xB800}, // Red
+    {0x3540, 0x2500}, // Green
+    {0xFD20, 0xFB00}  // Orange
+};
+
+// Ghost body colour by ghost type
+const uint16_t ghost_colors[4] = {C_RED, C_PINK, C_CYAN, C_ORNG};
+
 // Placeholder sprite arrays - replace with your actual bitmaps
 // Pac-Man sprites (16x16)
 const uint16_t pacman_anim1[16 * 16] = {
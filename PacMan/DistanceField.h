@@ -0,0 +1,121 @@
+#ifndef DISTANCE_FIELD_H
+#define DISTANCE_FIELD_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Walking distances between every pair of open tiles of a W x H maze,
+// built once per maze with a BFS from each open tile. Afterwards a ghost
+// picks its move by looking up the distance from each neighbour to its
+// target, so it goes around walls instead of getting stuck behind them.
+//
+// The maze comes in as one byte per tile: the low nibble holds the
+// directions a move can take from the tile (bit 1 << dir, dir in UP,
+// DOWN, LEFT, RIGHT order) and `closed` flags tiles that are not
+// destinations (walls, cage). A closed target stands for the nearest open
+// tile, so targets off the walkable maze (corners, tiles ahead of Pac-Man)
+// still pull in the right direction.
+//
+// Up to MAX_NODES (< 255) open tiles; MAX_NODES^2 bytes. Only <stdint.h> /
+// <string.h>, so it also builds on a host.
+template <int W, int H, int MAX_NODES> class DistanceField {
+public:
+  static const uint8_t FAR = 255; // Unreachable (or not built)
+
+  DistanceField() : _nodes(0) {}
+
+  // False if the maze has more than MAX_NODES open tiles; distance() then
+  // falls back to Manhattan distance
+  bool build(const uint8_t tiles[H][W], uint8_t closed) {
+    static const int dx[4] = {0, 0, -1, 1};
+    static const int dy[4] = {-1, 1, 0, 0};
+
+    _nodes = 0;
+    for (int y = 0; y < H; y++) {
+      for (int x = 0; x < W; x++) {
+        if (tiles[y][x] & closed) {
+          _node[y][x] = FAR;
+          continue;
+        }
+        if (_nodes == MAX_NODES) {
+          _nodes = 0;
+          return false;
+        }
+        _node[y][x] = _nodes;
+        _tileOf[_nodes++] = y * W + x;
+      }
+    }
+
+    // BFS from every open tile along the exits
+    uint8_t queue[MAX_NODES];
+    for (int from = 0; from < _nodes; from++) {
+      uint8_t *dist = _dist[from];
+      memset(dist, FAR, _nodes);
+      dist[from] = 0;
+      queue[0] = from;
+      int head = 0, tail = 1;
+      while (head < tail) {
+        int n = queue[head++];
+        int x = _tileOf[n] % W, y = _tileOf[n] / W;
+        for (int dir = 0; dir < 4; dir++) {
+          if (!(tiles[y][x] & (1 << dir)))
+            continue;
+          int next = _node[y + dy[dir]][x + dx[dir]];
+          if (next == FAR || dist[next] != FAR)
+            continue;
+          dist[next] = dist[n] + 1;
+          queue[tail++] = next;
+        }
+      }
+    }
+
+    // Closed tiles: nearest open tile by Manhattan distance, first in row
+    // order on ties
+    for (int y = 0; y < H; y++) {
+      for (int x = 0; x < W; x++) {
+        if (_node[y][x] != FAR) {
+          _nearest[y][x] = _node[y][x];
+          continue;
+        }
+        int best = 0, bestDist = W + H;
+        for (int n = 0; n < _nodes; n++) {
+          int d = manhattan(_tileOf[n] % W, _tileOf[n] / W, x, y);
+          if (d < bestDist) {
+            bestDist = d;
+            best = n;
+          }
+        }
+        _nearest[y][x] = best;
+      }
+    }
+    return true;
+  }
+
+  // Steps from open tile (x0, y0) to (x1, y1), which is clamped into the
+  // maze and snapped to the nearest open tile. FAR if unreachable.
+  int distance(int x0, int y0, int x1, int y1) const {
+    x1 = x1 < 0 ? 0 : (x1 < W ? x1 : W - 1);
+    y1 = y1 < 0 ? 0 : (y1 < H ? y1 : H - 1);
+    if (_nodes == 0)
+      return manhattan(x0, y0, x1, y1);
+    int from = _node[y0][x0];
+    if (from == FAR)
+      return FAR;
+    return _dist[from][_nearest[y1][x1]];
+  }
+
+  int nodes() const { return _nodes; }
+
+private:
+  uint8_t _node[H][W];    // Open tile index, FAR for closed tiles
+  uint8_t _nearest[H][W]; // Open tile standing for each tile as a target
+  uint16_t _tileOf[MAX_NODES];
+  uint8_t _dist[MAX_NODES][MAX_NODES];
+  int _nodes;
+
+  static int manhattan(int x0, int y0, int x1, int y1) {
+    return (x0 < x1 ? x1 - x0 : x0 - x1) + (y0 < y1 ? y1 - y0 : y0 - y1);
+  }
+};
+
+#endif
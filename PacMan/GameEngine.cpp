@@ -2,7 +2,7 @@
 #include "Assets.h"
 #include "System.h"
 
-Preferences preferences;
+SaveStore<PacManSave, 1> save;
 
 #define SCREEN_W 480
 #define SCREEN_H 320
@@ -11,8 +11,9 @@ Preferences preferences;
 #define MAZE_OFFSET_X 10
 #define MAZE_OFFSET_Y 4
 
-GameEngine::GameEngine(TFT_eSPI *tft, Input *input) : _tft(tft), _input(input) {
-  _canvas = new TFT_eSprite(tft);
+GameEngine::GameEngine(TFT_eSPI *tft, Input *input)
+    : _tft(tft), _input(input), _pipeline(tft) {
+  _canvas = nullptr;
   _state = STATE_MENU;
   _score = 0;
   _highScore = 0;
@@ -40,8 +41,6 @@ GameEngine::GameEngine(TFT_eSPI *tft, Input *input) : _tft(tft), _input(input) {
   _touchStartX = 0;
   _touchStartY = 0;
   _isTouching = false;
-  _lastJoystickDir = -1;
-  _lastJoystickTime = 0;
   _lastTouchY = 0;
   _touchJustStarted = false;
 
@@ -54,8 +53,20 @@ GameEngine::GameEngine(TFT_eSPI *tft, Input *input) : _tft(tft), _input(input) {
   _selectedMenuItem = 0;
   _selectedShopItem = 0;
   _selectedPauseOption = 0;
-  _lastJoystickMenuTime = 0;
-  _joystickMenuMoved = false;
+  _savedState = STATE_MENU;
+
+  _mazeVersion = 0;
+  _drawnMazeVersion = 0;
+  _lastDrawnState = STATE_MENU;
+  _lastHudScore = -1;
+  _lastHudLives = -1;
+  _pelletPulse = 0;
+  _lastPelletPulse = 0;
+  _mazeLayer = nullptr;
+  _bakedMazeVersion = 0;
+  _bakedTheme = -1;
+  for (int i = 0; i < 5; i++)
+    _lastActorRects[i] = {0, 0, -1, -1};
 
   for (int i = 1; i < 8; i++) {
     _ownedSkins[i] = false;
@@ -65,22 +76,20 @@ GameEngine::GameEngine(TFT_eSPI *tft, Input *input) : _tft(tft), _input(input) {
 }
 
 void GameEngine::init() {
-  preferences.begin("pacman", false);
-  _highScore = preferences.getInt("highScore", 0);
-  _totalCoins = preferences.getInt("totalCoins", 0);
-  _selectedSkin = preferences.getInt("skin", 0);
-  _selectedTheme = preferences.getInt("theme", 0);
-
-  for (int i = 0; i < 8; i++) {
-    _ownedSkins[i] = preferences.getBool(("skin_" + String(i)).c_str(), i == 0);
-    if (i < 4)
-      _ownedThemes[i] =
-          preferences.getBool(("theme_" + String(i)).c_str(), i == 0);
-  }
+  initSimulation();
+  initRender();
+}
+
+void GameEngine::initSimulation() {
+  loadGameData();
+  loadMaze(_level);
+  initializeGhosts();
+}
 
-  _canvas->setColorDepth(16);
-  void *ptr = _canvas->createSprite(SCREEN_W, 32);
-  if (!ptr) {
+void GameEngine::initRender() {
+  // Gameplay already pushes only damaged tiles (drawDamaged), so strips are
+  // enough here; RENDER_FRAMEBUFFER diffs whole frames instead
+  if (!_pipeline.begin(SCREEN_W, 32, SCREEN_H, RENDER_STRIPS)) {
     Serial.println("Failed to create strip sprite!");
     _useSprite = false;
   } else {
@@ -88,8 +97,21 @@ void GameEngine::init() {
     _useSprite = true;
   }
 
-  loadMaze(_level);
-  initializeGhosts();
+  _mazeLayer = new TFT_eSprite(_tft);
+  _mazeLayer->setColorDepth(16);
+  _mazeLayer->setAttribute(PSRAM_ENABLE, true);
+  if (!_mazeLayer->createSprite(SCREEN_W, SCREEN_H)) {
+    Serial.println("Maze layer unavailable, drawing walls per strip");
+    delete _mazeLayer;
+    _mazeLayer = nullptr;
+  }
+
+  // HUD column right of the maze (x 425-480), font 2
+  _hudScoreLabel.begin(_tft, 55, 16, 2, C_WHIT, TFT_BLACK);
+  _hudScoreLabel.setText("SCORE");
+  _hudScore.begin(_tft, 55, 16, 2, C_WHIT, TFT_BLACK);
+  _hudLivesLabel.begin(_tft, 55, 16, 2, C_WHIT, TFT_BLACK);
+  _hudLivesLabel.setText("LIVES");
 }
 
 void GameEngine::loadMaze() { loadMaze(_level); }
@@ -97,7 +119,7 @@ void GameEngine::loadMaze() { loadMaze(_level); }
 void GameEngine::loadMaze(int level) {
   // New 17x13 Maze
   // 0=Dot, 1=Wall, 2=PowerPellet, 3=Empty, 4=Cage(No Pacman)
-  int mazeTemplate[13][17] = {
+  static const uint8_t mazeTemplate[13][17] = {
       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
       {1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1},
       {1, 2, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 2, 1},
@@ -105,7 +127,7 @@ void GameEngine::loadMaze(int level) {
       {1, 0, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 0, 1},
       {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
       {1, 1, 1, 1, 0, 1, 4, 4, 4, 1, 0, 1, 1, 1, 1, 1,
-       1}, // Row 6: Cage at 7,8,9
+       1}, // Row 6: Cage at 6,7,8
       {1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 1},
       {1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1},
       {1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1},
@@ -113,18 +135,32 @@ void GameEngine::loadMaze(int level) {
       {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}};
 
-  _dots.clear();
-  _powerPellets.clear();
+  static const uint8_t tileOf[] = {TILE_DOT, TILE_WALL, TILE_PELLET, 0,
+                                   TILE_CAGE};
+  _dotsLeft = 0;
+  for (int y = 0; y < MAZE_HEIGHT; y++) {
+    for (int x = 0; x < MAZE_WIDTH; x++) {
+      _tiles[y][x] = tileOf[mazeTemplate[y][x]];
+      if (_tiles[y][x] & (TILE_DOT | TILE_PELLET))
+        _dotsLeft++;
+    }
+  }
 
+  // Exits: a neighbour inside the maze that is neither wall nor cage
   for (int y = 0; y < MAZE_HEIGHT; y++) {
     for (int x = 0; x < MAZE_WIDTH; x++) {
-      _maze[y][x] = mazeTemplate[y][x];
-      if (_maze[y][x] == 0)
-        _dots.push_back({x, y});
-      else if (_maze[y][x] == 2)
-        _powerPellets.push_back({x, y});
+      for (int dir = 0; dir < 4; dir++) {
+        int nx = x + DIR_DX[dir], ny = y + DIR_DY[dir];
+        if (nx < 0 || nx >= MAZE_WIDTH || ny < 0 || ny >= MAZE_HEIGHT)
+          continue;
+        if (!(_tiles[ny][nx] & (TILE_WALL | TILE_CAGE)))
+          _tiles[y][x] |= 1 << dir;
+      }
     }
   }
+  if (!_paths.build(_tiles, TILE_WALL | TILE_CAGE))
+    Serial.println("Maze too big for ghost paths, using Manhattan distance");
+  _mazeVersion++; // Every dot is back on screen
 }
 
 float GameEngine::getPacmanSpeed() {
@@ -158,19 +194,15 @@ void GameEngine::updateGhosts(float dt) {
 }
 
 void GameEngine::initializeGhosts() {
-  _ghosts.clear();
   // Adjust spawn points for 17x13 maze
   // Cage is at 7,6 / 8,6 / 9,6
   // Blinky outside at 8,5
   // Others inside
-  Ghost blinky = {{8, 5}, {8, 5}, {0, 0}, DIR_LEFT, 0, false, false, 0};
-  Ghost pinky = {{7, 6}, {7, 6}, {0, 0}, DIR_UP, 1, false, false, 0};
-  Ghost inky = {{8, 6}, {8, 6}, {0, 0}, DIR_UP, 2, false, false, 0};
-  Ghost clyde = {{9, 6}, {9, 6}, {0, 0}, DIR_UP, 3, false, false, 0};
-  _ghosts.push_back(blinky);
-  _ghosts.push_back(pinky);
-  _ghosts.push_back(inky);
-  _ghosts.push_back(clyde);
+  // Blinky, Pinky, Inky, Clyde
+  _ghosts[0] = {{8, 5}, {8, 5}, {0, 0}, DIR_LEFT, 0, false, false};
+  _ghosts[1] = {{7, 6}, {7, 6}, {0, 0}, DIR_UP, 1, false, false};
+  _ghosts[2] = {{8, 6}, {8, 6}, {0, 0}, DIR_UP, 2, false, false};
+  _ghosts[3] = {{9, 6}, {9, 6}, {0, 0}, DIR_UP, 3, false, false};
 }
 
 void GameEngine::startGame() {
@@ -198,6 +230,8 @@ void GameEngine::resetLevel() {
 }
 
 void GameEngine::update(float dt) {
+  PROFILE_SCOPE(PROF_UPDATE);
+  _input->poll();
   Point touch = _input->getTouch(SCREEN_W, SCREEN_H);
   unsigned long currentTime = millis();
 
@@ -210,23 +244,16 @@ void GameEngine::update(float dt) {
   if (_clickDebounce)
     touch.touched = false;
 
+  saveBehind();
+
   switch (_state) {
   case STATE_MENU: {
     ButtonInput buttons = _input->getButtons();
-    JoystickInput joy = _input->getJoystick();
-    if (joy.active && !_joystickMenuMoved) {
-      if (joy.direction == INPUT_DIR_DOWN && _selectedMenuItem < 2) {
-        _selectedMenuItem++;
-        _joystickMenuMoved = true;
-        _lastJoystickMenuTime = currentTime;
-      } else if (joy.direction == INPUT_DIR_UP && _selectedMenuItem > 0) {
-        _selectedMenuItem--;
-        _joystickMenuMoved = true;
-        _lastJoystickMenuTime = currentTime;
-      }
-    }
-    if (!joy.active || currentTime - _lastJoystickMenuTime > 200)
-      _joystickMenuMoved = false;
+    InputDirection nav = _input->getNavigation();
+    if (nav == INPUT_DIR_DOWN && _selectedMenuItem < 2)
+      _selectedMenuItem++;
+    else if (nav == INPUT_DIR_UP && _selectedMenuItem > 0)
+      _selectedMenuItem--;
 
     if (buttons.aJustPressed && !_clickDebounce) {
       _clickDebounce = true;
@@ -260,36 +287,23 @@ void GameEngine::update(float dt) {
   }
   case STATE_SHOP: {
     ButtonInput buttons = _input->getButtons();
-    JoystickInput joy = _input->getJoystick();
-    if (joy.active && !_joystickMenuMoved) {
-      if (joy.direction == INPUT_DIR_RIGHT && (_selectedShopItem % 4) < 3 &&
-          _selectedShopItem < 11) {
-        _selectedShopItem++;
-        _joystickMenuMoved = true;
-        _lastJoystickMenuTime = currentTime;
-      } else if (joy.direction == INPUT_DIR_LEFT &&
-                 (_selectedShopItem % 4) > 0) {
-        _selectedShopItem--;
-        _joystickMenuMoved = true;
-        _lastJoystickMenuTime = currentTime;
-      } else if (joy.direction == INPUT_DIR_DOWN) {
-        if (_selectedShopItem < 8)
-          _selectedShopItem += 4;
-        else if (_selectedShopItem < 12)
-          _selectedShopItem = 12; // Go to Back button
-        _joystickMenuMoved = true;
-        _lastJoystickMenuTime = currentTime;
-      } else if (joy.direction == INPUT_DIR_UP) {
-        if (_selectedShopItem == 12)
-          _selectedShopItem = 8;
-        else if (_selectedShopItem >= 4)
-          _selectedShopItem -= 4;
-        _joystickMenuMoved = true;
-        _lastJoystickMenuTime = currentTime;
-      }
+    InputDirection nav = _input->getNavigation();
+    if (nav == INPUT_DIR_RIGHT && (_selectedShopItem % 4) < 3 &&
+        _selectedShopItem < 11) {
+      _selectedShopItem++;
+    } else if (nav == INPUT_DIR_LEFT && (_selectedShopItem % 4) > 0) {
+      _selectedShopItem--;
+    } else if (nav == INPUT_DIR_DOWN) {
+      if (_selectedShopItem < 8)
+        _selectedShopItem += 4;
+      else if (_selectedShopItem < 12)
+        _selectedShopItem = 12; // Go to Back button
+    } else if (nav == INPUT_DIR_UP) {
+      if (_selectedShopItem == 12)
+        _selectedShopItem = 8;
+      else if (_selectedShopItem >= 4)
+        _selectedShopItem -= 4;
     }
-    if (!joy.active || currentTime - _lastJoystickMenuTime > 200)
-      _joystickMenuMoved = false;
 
     // Manual scroll logic only (removed auto-scroll)
     // Ensure selected item is visible
@@ -316,26 +330,18 @@ void GameEngine::update(float dt) {
       if (isSkin) {
         if (_ownedSkins[itemIndex]) {
           _selectedSkin = itemIndex;
-          preferences.putInt("skin", itemIndex);
         } else if (_totalCoins >= price) {
           _totalCoins -= price;
           _ownedSkins[itemIndex] = true;
           _selectedSkin = itemIndex;
-          preferences.putBool(("skin_" + String(itemIndex)).c_str(), true);
-          preferences.putInt("skin", itemIndex);
-          preferences.putInt("totalCoins", _totalCoins);
         }
       } else {
         if (_ownedThemes[itemIndex]) {
           _selectedTheme = itemIndex;
-          preferences.putInt("theme", itemIndex);
         } else if (_totalCoins >= price) {
           _totalCoins -= price;
           _ownedThemes[itemIndex] = true;
           _selectedTheme = itemIndex;
-          preferences.putBool(("theme_" + String(itemIndex)).c_str(), true);
-          preferences.putInt("theme", itemIndex);
-          preferences.putInt("totalCoins", _totalCoins);
         }
       }
     }
@@ -397,28 +403,18 @@ void GameEngine::update(float dt) {
             if (isSkin) {
               if (_ownedSkins[itemIndex]) {
                 _selectedSkin = itemIndex;
-                preferences.putInt("skin", itemIndex);
               } else if (_totalCoins >= price) {
                 _totalCoins -= price;
                 _ownedSkins[itemIndex] = true;
                 _selectedSkin = itemIndex;
-                preferences.putBool(("skin_" + String(itemIndex)).c_str(),
-                                    true);
-                preferences.putInt("skin", itemIndex);
-                preferences.putInt("totalCoins", _totalCoins);
               }
             } else {
               if (_ownedThemes[itemIndex]) {
                 _selectedTheme = itemIndex;
-                preferences.putInt("theme", itemIndex);
               } else if (_totalCoins >= price) {
                 _totalCoins -= price;
                 _ownedThemes[itemIndex] = true;
                 _selectedTheme = itemIndex;
-                preferences.putBool(("theme_" + String(itemIndex)).c_str(),
-                                    true);
-                preferences.putInt("theme", itemIndex);
-                preferences.putInt("totalCoins", _totalCoins);
               }
             }
           }
@@ -460,26 +456,17 @@ void GameEngine::update(float dt) {
       for (auto &ghost : _ghosts)
         ghost.frightened = false;
     }
-    if (_dots.empty() && _powerPellets.empty())
+    if (_dotsLeft == 0)
       nextLevel();
     break;
   }
   case STATE_PAUSED: {
     ButtonInput buttons = _input->getButtons();
-    JoystickInput joy = _input->getJoystick();
-    if (joy.active && !_joystickMenuMoved) {
-      if (joy.direction == INPUT_DIR_DOWN && _selectedPauseOption < 1) {
-        _selectedPauseOption++;
-        _joystickMenuMoved = true;
-        _lastJoystickMenuTime = currentTime;
-      } else if (joy.direction == INPUT_DIR_UP && _selectedPauseOption > 0) {
-        _selectedPauseOption--;
-        _joystickMenuMoved = true;
-        _lastJoystickMenuTime = currentTime;
-      }
-    }
-    if (!joy.active || currentTime - _lastJoystickMenuTime > 200)
-      _joystickMenuMoved = false;
+    InputDirection nav = _input->getNavigation();
+    if (nav == INPUT_DIR_DOWN && _selectedPauseOption < 1)
+      _selectedPauseOption++;
+    else if (nav == INPUT_DIR_UP && _selectedPauseOption > 0)
+      _selectedPauseOption--;
     if (buttons.aJustPressed && !_clickDebounce) {
       _clickDebounce = true;
       if (_selectedPauseOption == 0)
@@ -523,35 +510,11 @@ void GameEngine::update(float dt) {
 }
 
 void GameEngine::handleInput(Point touch) {
-  JoystickInput joy = _input->getJoystick();
-  if (joy.active && joy.direction != INPUT_DIR_NONE) {
-    unsigned long currentTime = millis();
-    Direction gameDir = DIR_NONE;
-    switch (joy.direction) {
-    case INPUT_DIR_UP:
-      gameDir = DIR_UP;
-      break;
-    case INPUT_DIR_DOWN:
-      gameDir = DIR_DOWN;
-      break;
-    case INPUT_DIR_LEFT:
-      gameDir = DIR_LEFT;
-      break;
-    case INPUT_DIR_RIGHT:
-      gameDir = DIR_RIGHT;
-      break;
-    default:
-      gameDir = DIR_NONE;
-      break;
-    }
-    if (_lastJoystickDir != gameDir || currentTime - _lastJoystickTime > 150) {
-      _nextDir = gameDir;
-      _lastJoystickDir = gameDir;
-      _lastJoystickTime = currentTime;
-    }
-  } else {
-    _lastJoystickDir = -1;
-  }
+  // The joystick turns on the tick it is pushed, and again every repeat
+  // while held in case a swipe changed the turn in between
+  InputDirection nav = _input->getNavigation();
+  if (nav != INPUT_DIR_NONE)
+    _nextDir = (Direction)nav; // Same order as InputDirection
   if (touch.touched) {
     bool isPauseArea =
         touch.x > SCREEN_W - 60 && touch.y > 250; // Updated pause area check
@@ -580,59 +543,48 @@ void GameEngine::movePacman() {
   if (isValidMove(_pacman.x, _pacman.y, _pacmanDir)) {
     _pacman = getNextPosition(_pacman, _pacmanDir);
     eatDot(_pacman.x, _pacman.y);
-    for (auto it = _powerPellets.begin(); it != _powerPellets.end();) {
-      if (it->x == _pacman.x && it->y == _pacman.y) {
-        eatPowerPellet(it->x, it->y);
-        it = _powerPellets.erase(it);
-      } else
-        ++it;
-    }
+    if (_tiles[_pacman.y][_pacman.x] & TILE_PELLET)
+      eatPowerPellet(_pacman.x, _pacman.y);
   }
 }
 
 void GameEngine::updateGhost(Ghost &ghost, float dt) {
   if (ghost.eaten) {
-    if (millis() - ghost.deadTime > 8000) {
+    // Eyes walk back to the cage door, then drop into the box as a ghost
+    if (ghost.pos.x == 8 && ghost.pos.y == 5) {
       ghost.eaten = false;
-      ghost.frightened = false;
       ghost.pos = {8, 6};    // Respawn in box
       ghost.target = {8, 4}; // Target exit
+      return;
     }
-    return; // Don't move while dead/hidden
-  }
-
-  if (ghost.pos.y == 6 && ghost.pos.x >= 7 && ghost.pos.x <= 9) {
+    ghost.target = {8, 5};
+  } else if (ghost.pos.y == 6 && ghost.pos.x >= 7 && ghost.pos.x <= 9) {
     ghost.target = {8, 4};
   } else if (_frightenedMode) {
     ghost.target = {random(0, MAZE_WIDTH), random(0, MAZE_HEIGHT)};
   } else {
     ghost.target = getGhostTarget(ghost.type);
   }
-  std::vector<Direction> possibleDirs;
-  for (int dir = 0; dir < 4; dir++) {
-    if (isValidMove(ghost.pos.x, ghost.pos.y, (Direction)dir) &&
-        dir != getOppositeDirection(ghost.dir)) {
-      possibleDirs.push_back((Direction)dir);
-    }
-  }
-  // If no valid moves (dead end), allow reversing
-  if (possibleDirs.empty()) {
-    if (isValidMove(ghost.pos.x, ghost.pos.y,
-                    getOppositeDirection(ghost.dir))) {
-      possibleDirs.push_back(getOppositeDirection(ghost.dir));
-    }
-  }
-
-  if (!possibleDirs.empty()) {
-    Direction bestDir = possibleDirs[0];
-    int bestDist =
-        manhattanDistance(getNextPosition(ghost.pos, bestDir), ghost.target);
-    for (auto dir : possibleDirs) {
+  // Any exit but going back; reversing only out of a dead end. Of those,
+  // the one with the shortest walk to the target.
+  uint8_t exits = _tiles[ghost.pos.y][ghost.pos.x] & TILE_EXITS;
+  uint8_t back = 1 << getOppositeDirection(ghost.dir);
+  uint8_t options = exits & ~back;
+  if (!options)
+    options = exits & back;
+
+  if (options) {
+    Direction bestDir = DIR_NONE;
+    int bestDist = 0;
+    for (int dir = 0; dir < 4; dir++) {
+      if (!(options & (1 << dir)))
+        continue;
+      Position next = getNextPosition(ghost.pos, (Direction)dir);
       int dist =
-          manhattanDistance(getNextPosition(ghost.pos, dir), ghost.target);
-      if (dist < bestDist) {
+          _paths.distance(next.x, next.y, ghost.target.x, ghost.target.y);
+      if (bestDir == DIR_NONE || dist < bestDist) {
         bestDist = dist;
-        bestDir = dir;
+        bestDir = (Direction)dir;
       }
     }
     ghost.dir = bestDir;
@@ -681,7 +633,6 @@ void GameEngine::checkCollisions() {
     if (collision) {
       if (ghost.frightened) {
         ghost.eaten = true;
-        ghost.deadTime = millis(); // Set death time
         ghost.frightened = false;
         _score += 200;
       } else {
@@ -698,28 +649,23 @@ void GameEngine::checkCollisions() {
 }
 
 void GameEngine::eatDot(int x, int y) {
-  for (auto it = _dots.begin(); it != _dots.end();) {
-    if (it->x == x && it->y == y) {
-      _score += 10;
-      _coins += 1;
-      _totalCoins += 1;
-      _dotsEaten++;
-      _maze[y][x] = 3;
-      it = _dots.erase(it);
-      preferences.putInt("totalCoins", _totalCoins);
-      break;
-    } else
-      ++it;
-  }
+  if (!(_tiles[y][x] & TILE_DOT))
+    return;
+  _score += 10;
+  _coins += 1;
+  _totalCoins += 1;
+  _dotsEaten++;
+  _tiles[y][x] &= ~TILE_DOT;
+  _dotsLeft--;
 }
 
 void GameEngine::eatPowerPellet(int x, int y) {
   _score += 50;
   _coins += 5;
   _totalCoins += 5;
-  _maze[y][x] = 3; // Mark as eaten (empty)
+  _tiles[y][x] &= ~TILE_PELLET; // Mark as eaten (empty)
+  _dotsLeft--;
   scareGhosts();
-  preferences.putInt("totalCoins", _totalCoins);
 }
 
 void GameEngine::scareGhosts() {
@@ -736,6 +682,7 @@ void GameEngine::scareGhosts() {
 
 void GameEngine::respawnPacman() {
   _pacman = {8, 9};
+  _prevPacman = _pacman; // No interpolation from where it died
   _pacmanDir = DIR_RIGHT;
   _nextDir = DIR_NONE;
   _moveTimer = 0;
@@ -744,144 +691,367 @@ void GameEngine::respawnPacman() {
 void GameEngine::respawnGhosts() { initializeGhosts(); }
 
 void GameEngine::nextLevel() {
+  saveGameData();
+  save.flush(); // Between levels the stall goes unnoticed
   _level++;
   resetLevel();
   if (_level > 5) {
     _state = STATE_WIN;
-    if (_score > _highScore) {
+    if (_score > _highScore)
       _highScore = _score;
-      preferences.putInt("highScore", _highScore);
-    }
   }
 }
 
 void GameEngine::gameOver() {
   _state = STATE_GAMEOVER;
-  if (_score > _highScore) {
+  if (_score > _highScore)
     _highScore = _score;
-    preferences.putInt("highScore", _highScore);
-  }
 }
 
-void GameEngine::draw() {
+void GameEngine::draw(float alpha) {
+  PROFILE_SCOPE(PROF_FRAME);
   if (!_useSprite) {
     _tft->fillScreen(TFT_BLACK);
     return;
   }
-  for (int y = 0; y < SCREEN_H; y += 32) {
-    _canvas->fillSprite(TFT_BLACK);
-    switch (_state) {
-    case STATE_MENU:
-      drawMenu(y);
-      break;
-    case STATE_PLAYING:
-      drawMaze(y);
-      drawPacman(y);
-      drawGhosts(y);
-      drawHUD(y);
-      break;
-    case STATE_PAUSED:
-      drawMaze(y);
-      drawPacman(y);
-      drawGhosts(y);
-      drawHUD(y);
-      drawPauseMenu(y);
-      break;
-    case STATE_GAMEOVER:
-      drawGameOver(y);
-      break;
-    case STATE_WIN:
-      drawWinScreen(y);
-      break;
-    case STATE_SHOP:
-      drawShop(y);
-      break;
-    }
-    _canvas->pushSprite(0, y);
-  }
+  _pelletPulse = (millis() / 150) % 2;
+  if (_state != STATE_PLAYING && _pipeline.unchanged(viewKey()))
+    return; // Static screen, already on display
+  _hudScore.setValue("%d", _score);
+  if (_mazeLayer &&
+      (_bakedMazeVersion != _mazeVersion || _bakedTheme != _selectedTheme))
+    bakeMaze();
+  buildDisplayList(alpha);
+  // During gameplay only the tiles that changed since last frame are pushed.
+  // A framebuffer pipeline finds the damage itself. The profiler overlay
+  // lives in the last strip, so it needs full frames.
+  if (_state == STATE_PLAYING && _lastDrawnState == STATE_PLAYING &&
+      _drawnMazeVersion == _mazeVersion && !_pipeline.framebuffer() &&
+      !Profiler::overlayVisible())
+    drawDamaged();
+  else
+    drawFull();
+  _lastDrawnState = _state;
 }
 
-void GameEngine::drawMaze(int offsetY) {
-  uint16_t wallColor, wallInnerColor;
-  switch (_selectedTheme) {
-  case 1:
-    wallColor = 0xD820;
-    wallInnerColor = 0xB800;
+// What the menus and other static screens are drawn from; while it stays
+// the same draw() neither renders nor pushes anything
+ViewKey GameEngine::viewKey() const {
+  ViewKey key;
+  key.mix(_state);
+  switch (_state) {
+  case STATE_MENU:
+    key.mix(_selectedMenuItem).mix(_mazeVersion);
+    break;
+  case STATE_PAUSED:
+    // Frozen playfield under the menu; only the power pellets pulse
+    key.mix(_selectedPauseOption).mix(_pelletPulse).mix(_mazeVersion);
+    key.mix(_dotsLeft).mix(_score).mix(_lives).mix(_selectedSkin);
+    key.mix(_selectedTheme);
+    if (_frightenedMode)
+      key.mix((millis() / 250) % 2); // Frightened ghosts flash
     break;
-  case 2:
-    wallColor = 0x3540;
-    wallInnerColor = 0x2500;
+  case STATE_GAMEOVER:
+    key.mix(_score).mix(_highScore).mix((millis() / 500) % 2);
     break;
-  case 3:
-    wallColor = 0xFD20;
-    wallInnerColor = 0xFB00;
+  case STATE_SHOP: {
+    uint32_t owned = 0;
+    for (int i = 0; i < 8; i++)
+      owned |= _ownedSkins[i] << i;
+    for (int i = 0; i < 4; i++)
+      owned |= _ownedThemes[i] << (8 + i);
+    key.mix(_selectedShopItem).mix(_shopScrollOffset).mix(_totalCoins);
+    key.mix(_selectedSkin).mix(_selectedTheme).mix(owned);
     break;
+  }
   default:
-    wallColor = C_BLUE;
-    wallInnerColor = 0x0010;
     break;
   }
+  return key;
+}
+
+void GameEngine::drawFull() {
+  int stripH = _pipeline.stripHeight();
+  _pipeline.beginFrame();
+  for (int stripY = 0; stripY < SCREEN_H; stripY += stripH) {
+    _canvas = _pipeline.beginStrip();
+    for (int row = 0; row < stripH; row += 32) {
+      int y = stripY + row;
+      _pipeline.selectBand(row);
+      if (_state == STATE_PLAYING || _state == STATE_PAUSED)
+        drawMazeLayer(y);
+      else
+        _canvas->fillSprite(TFT_BLACK);
+      switch (_state) {
+      case STATE_MENU:
+        drawMenu(y);
+        break;
+      case STATE_PLAYING:
+        drawPlayfield(y);
+        break;
+      case STATE_PAUSED:
+        drawPlayfield(y);
+        drawPauseMenu(y);
+        break;
+      case STATE_GAMEOVER:
+        drawGameOver(y);
+        break;
+      case STATE_WIN:
+        drawWinScreen(y);
+        break;
+      case STATE_SHOP:
+        drawShop(y);
+        break;
+      }
+    }
+    _pipeline.pushStrip(stripY);
+  }
+  _pipeline.endFrame();
+
+  // Remember what is on screen so the next frame can push only the damage
+  _lastActorRects[0] = getActorTiles(_prevPacman, _pacman, 0);
+  for (int i = 0; i < NUM_GHOSTS; i++) {
+    const Ghost &ghost = _ghosts[i];
+    _lastActorRects[i + 1] = getActorTiles(ghost.prevPos, ghost.pos, 1);
+  }
+  _lastHudScore = _score;
+  _lastHudLives = _lives;
+  _lastPelletPulse = _pelletPulse;
+  _drawnMazeVersion = _mazeVersion;
+}
+
+void GameEngine::drawDamaged() {
+  memset(_dirtyTiles, 0, sizeof(_dirtyTiles));
+  _pipeline.beginFrame();
+
+  // Actors damage the tiles they cover now and the ones they covered last
+  // frame. The interpolation span is covered by the prev/current positions.
+  TileRect rect = getActorTiles(_prevPacman, _pacman, 0);
+  markTiles(rect);
+  markTiles(_lastActorRects[0]);
+  _lastActorRects[0] = rect;
+  for (int i = 0; i < NUM_GHOSTS; i++) {
+    const Ghost &ghost = _ghosts[i];
+    // Ghost heads and feet overhang their tile by a couple of pixels
+    rect = getActorTiles(ghost.prevPos, ghost.pos, 1);
+    markTiles(rect);
+    markTiles(_lastActorRects[i + 1]);
+    _lastActorRects[i + 1] = rect;
+  }
+
+  // Power pellets pulse on a timer
+  if (_pelletPulse != _lastPelletPulse) {
+    for (int y = 0; y < MAZE_HEIGHT; y++)
+      for (int x = 0; x < MAZE_WIDTH; x++)
+        if (_tiles[y][x] & TILE_PELLET)
+          _dirtyTiles[y] |= 1u << x;
+    _lastPelletPulse = _pelletPulse;
+  }
+
+  // Re-render each damaged maze row once and push its dirty column spans
+  for (int row = 0; row < MAZE_HEIGHT; row++) {
+    uint32_t bits = _dirtyTiles[row];
+    if (!bits)
+      continue;
+    int bandY = MAZE_OFFSET_Y + row * TILE_SIZE;
+    _canvas = _pipeline.beginStrip();
+    _pipeline.selectBand(0);
+    drawMazeLayer(bandY);
+    drawMaze(bandY);
+    drawActors(bandY, TILE_SIZE);
+    int x = 0;
+    while (x < MAZE_WIDTH) {
+      if (!(bits & (1u << x))) {
+        x++;
+        continue;
+      }
+      int start = x;
+      while (x < MAZE_WIDTH && (bits & (1u << x)))
+        x++;
+      int spanX = MAZE_OFFSET_X + start * TILE_SIZE;
+      int spanW = (x - start) * TILE_SIZE;
+      _pipeline.pushRegion(spanX, bandY, spanX, 0, spanW, TILE_SIZE);
+    }
+  }
+
+  // HUD fields (score at Y=60, lives icons from Y=130)
+  if (_score != _lastHudScore) {
+    pushHudRegion(32, 64);
+    _lastHudScore = _score;
+  }
+  if (_lives != _lastHudLives) {
+    pushHudRegion(128, 64);
+    _lastHudLives = _lives;
+  }
+  _pipeline.endFrame();
+}
+
+void GameEngine::drawPlayfield(int offsetY) {
+  drawMaze(offsetY);
+  drawActors(offsetY, 32);
+  drawHUD(offsetY);
+}
+
+// Re-renders HUD rows [y, y + h) on the 32px strip grid and pushes only the
+// HUD column to the right of the maze
+void GameEngine::pushHudRegion(int y, int h) {
+  const int hudLeft = MAZE_OFFSET_X + MAZE_WIDTH * TILE_SIZE;
+  for (int stripY = y; stripY < y + h; stripY += 32) {
+    _canvas = _pipeline.beginStrip();
+    _pipeline.selectBand(0);
+    _canvas->fillSprite(TFT_BLACK);
+    drawHUD(stripY);
+    _pipeline.pushRegion(hudLeft, stripY, hudLeft, 0, SCREEN_W - hudLeft, 32);
+  }
+}
+
+GameEngine::TileRect GameEngine::getActorTiles(Position prev, Position cur,
+                                               int pad) {
+  TileRect r;
+  r.x0 = max(0, min(prev.x, cur.x));
+  r.x1 = min(MAZE_WIDTH - 1, max(prev.x, cur.x));
+  r.y0 = max(0, min(prev.y, cur.y) - pad);
+  r.y1 = min(MAZE_HEIGHT - 1, max(prev.y, cur.y) + pad);
+  return r;
+}
+
+void GameEngine::markTiles(const TileRect &r) {
+  for (int y = r.y0; y <= r.y1; y++)
+    for (int x = r.x0; x <= r.x1; x++)
+      _dirtyTiles[y] |= 1u << x;
+}
+
+// Rasterizes the walls once into the maze layer
+void GameEngine::bakeMaze() {
+  _mazeLayer->fillSprite(TFT_BLACK);
+  drawWalls(_mazeLayer, 0, SCREEN_H);
+  _bakedMazeVersion = _mazeVersion;
+  _bakedTheme = _selectedTheme;
+}
+
+// Starts the current band as a row copy of the maze layer. Both are 16-bit
+// sprites, so their buffers share the panel byte order.
+void GameEngine::drawMazeLayer(int offsetY) {
+  if (!_mazeLayer) {
+    _canvas->fillSprite(TFT_BLACK);
+    return;
+  }
+  int bandH = _canvas->getViewportHeight();
+  int rows = constrain(SCREEN_H - offsetY, 0, bandH);
+  uint16_t *dst = (uint16_t *)_canvas->getPointer() +
+                  _canvas->getViewportY() * SCREEN_W;
+  const uint16_t *src = (uint16_t *)_mazeLayer->getPointer() +
+                        offsetY * SCREEN_W;
+  memcpy(dst, src, rows * SCREEN_W * sizeof(uint16_t));
+  if (rows < bandH)
+    _canvas->fillRect(0, rows, SCREEN_W, bandH - rows, TFT_BLACK);
+}
+
+void GameEngine::drawWalls(TFT_eSprite *dst, int offsetY, int height) {
+  const MazeTheme &theme = maze_themes[constrain(_selectedTheme, 0, 3)];
   for (int y = 0; y < MAZE_HEIGHT; y++) {
+    int screenY = MAZE_OFFSET_Y + y * TILE_SIZE - offsetY;
+    if (screenY < -TILE_SIZE || screenY >= height)
+      continue;
     for (int x = 0; x < MAZE_WIDTH; x++) {
-      int screenX = MAZE_OFFSET_X + x * TILE_SIZE;
-      int screenY = MAZE_OFFSET_Y + y * TILE_SIZE - offsetY;
-      if (screenY < -TILE_SIZE || screenY >= 32)
+      if (!(_tiles[y][x] & TILE_WALL))
         continue;
-      switch (_maze[y][x]) {
-      case 1: // Wall
-        _canvas->fillRect(screenX, screenY, TILE_SIZE, TILE_SIZE,
-                          wallInnerColor);
-        _canvas->drawRect(screenX, screenY, TILE_SIZE, TILE_SIZE, wallColor);
-        break;
-      case 0:
+      int screenX = MAZE_OFFSET_X + x * TILE_SIZE;
+      dst->fillRect(screenX, screenY, TILE_SIZE, TILE_SIZE, theme.wallInner);
+      dst->drawRect(screenX, screenY, TILE_SIZE, TILE_SIZE, theme.wall);
+    }
+  }
+}
+
+// Dots and pellets on top of the band; walls come from the maze layer
+void GameEngine::drawMaze(int offsetY) {
+  if (!_mazeLayer)
+    drawWalls(_canvas, offsetY, 32);
+  for (int y = 0; y < MAZE_HEIGHT; y++) {
+    int screenY = MAZE_OFFSET_Y + y * TILE_SIZE - offsetY;
+    if (screenY < -TILE_SIZE || screenY >= 32)
+      continue;
+    for (int x = 0; x < MAZE_WIDTH; x++) {
+      int screenX = MAZE_OFFSET_X + x * TILE_SIZE;
+      if (_tiles[y][x] & TILE_DOT) {
         _canvas->fillCircle(screenX + TILE_SIZE / 2, screenY + TILE_SIZE / 2, 2,
                             C_WHIT);
-        break;
-      case 2: {
-        int pulse = (millis() / 150) % 2;
-        int pelletSize = 4 + pulse;
+      } else if (_tiles[y][x] & TILE_PELLET) {
+        int pelletSize = 4 + _pelletPulse;
         _canvas->fillCircle(screenX + TILE_SIZE / 2, screenY + TILE_SIZE / 2,
                             pelletSize, C_WHIT);
-      } break;
-      case 4: // Cage (Draw as empty but maybe a door line?)
-        // Optional: Draw a door line for the cage entrance if needed, but for
-        // now just empty
-        break;
       }
     }
   }
 }
 
-void GameEngine::drawPacman(int offsetY) {
-  float t = _moveTimer / getPacmanSpeed();
+// Resolves Pac-Man and the ghosts once per frame: interpolated tile
+// position, color and the rows they cover. alpha carries the movement on
+// past the last tick so steps stay smooth between ticks.
+void GameEngine::buildDisplayList(float alpha) {
+  _displayList.begin(32, SCREEN_H);
+  if (_state != STATE_PLAYING && _state != STATE_PAUSED) {
+    _displayList.finish();
+    return;
+  }
+
+  float ahead = alpha / TICK_HZ;
+  float t = (_moveTimer + ahead) / getPacmanSpeed();
   if (t > 1.0f)
     t = 1.0f;
   float interpX = _prevPacman.x + (_pacman.x - _prevPacman.x) * t;
   float interpY = _prevPacman.y + (_pacman.y - _prevPacman.y) * t;
   int screenX = MAZE_OFFSET_X + (int)(interpX * TILE_SIZE);
-  int screenY = MAZE_OFFSET_Y + (int)(interpY * TILE_SIZE) - offsetY;
-  if (screenY < -TILE_SIZE || screenY >= 32)
-    return;
+  int screenY = MAZE_OFFSET_Y + (int)(interpY * TILE_SIZE);
+  DisplayItem *item =
+      _displayList.add(DL_PACMAN, screenY, screenY + TILE_SIZE);
+  if (item) {
+    item->x = screenX;
+    item->y = screenY;
+    item->color = pacman_skin_colors[constrain(_selectedSkin, 0, 7)];
+  }
+
+  t = (_ghostMoveTimer + ahead) / getGhostSpeed();
+  if (t > 1.0f)
+    t = 1.0f;
+  for (const auto &ghost : _ghosts) {
+    interpX = ghost.prevPos.x + (ghost.pos.x - ghost.prevPos.x) * t;
+    interpY = ghost.prevPos.y + (ghost.pos.y - ghost.prevPos.y) * t;
+    screenX = MAZE_OFFSET_X + (int)(interpX * TILE_SIZE);
+    screenY = MAZE_OFFSET_Y + (int)(interpY * TILE_SIZE);
+    // Head and feet overhang the tile by a couple of pixels
+    item = _displayList.add(DL_GHOST, screenY - 2, screenY + TILE_SIZE + 3);
+    if (!item)
+      continue;
+    uint16_t color = C_RED;
+    if (ghost.frightened)
+      color = (millis() / 250) % 2 ? C_BLUE : C_WHIT;
+    else if (ghost.type >= 0 && ghost.type < 4)
+      color = ghost_colors[ghost.type];
+    item->x = screenX;
+    item->y = screenY;
+    item->color = color;
+    item->data = &ghost;
+  }
+  _displayList.finish();
+}
+
+void GameEngine::drawActors(int offsetY, int height) {
+  _displayList.forEach(offsetY, height, [&](const DisplayItem &item) {
+    if (item.kind == DL_PACMAN)
+      drawPacman(item, offsetY);
+    else
+      drawGhost(item, offsetY);
+  });
+}
+
+void GameEngine::drawPacman(const DisplayItem &item, int offsetY) {
+  int screenX = item.x;
+  int screenY = item.y - offsetY;
   int radius = TILE_SIZE / 2 - 1;
   int centerX = screenX + TILE_SIZE / 2;
   int centerY = screenY + TILE_SIZE / 2;
-  uint16_t pacmanColor = C_YELL;
-  if (_selectedSkin == 1)
-    pacmanColor = C_PINK;
-  else if (_selectedSkin == 2)
-    pacmanColor = C_CYAN;
-  else if (_selectedSkin == 3)
-    pacmanColor = C_GREN;
-  else if (_selectedSkin == 4)
-    pacmanColor = 0xF800; // Red
-  else if (_selectedSkin == 5)
-    pacmanColor = 0x7E0; // Green
-  else if (_selectedSkin == 6)
-    pacmanColor = 0x001F; // Blue
-  else if (_selectedSkin == 7)
-    pacmanColor = 0xFFFF; // White
-
-  _canvas->fillCircle(centerX, centerY, radius, pacmanColor);
+  _canvas->fillCircle(centerX, centerY, radius, item.color);
 
   if (_mouthOpen) {
     int x1 = centerX, y1 = centerY;
@@ -938,53 +1108,24 @@ void GameEngine::drawPacman(int offsetY) {
   }
 }
 
-void GameEngine::drawGhosts(int offsetY) {
-  for (const auto &ghost : _ghosts)
-    drawGhost(ghost, offsetY);
-}
-
-void GameEngine::drawGhost(const Ghost &ghost, int offsetY) {
-  if (ghost.eaten)
-    return; // Don't draw if eaten/hidden
-
-  float t = _ghostMoveTimer / getGhostSpeed();
-  if (t > 1.0f)
-    t = 1.0f;
-  float interpX = ghost.prevPos.x + (ghost.pos.x - ghost.prevPos.x) * t;
-  float interpY = ghost.prevPos.y + (ghost.pos.y - ghost.prevPos.y) * t;
-  int screenX = MAZE_OFFSET_X + (int)(interpX * TILE_SIZE);
-  int screenY = MAZE_OFFSET_Y + (int)(interpY * TILE_SIZE) - offsetY;
-  if (screenY < -TILE_SIZE || screenY >= 32)
-    return;
-  uint16_t color = C_RED;
-  if (ghost.frightened)
-    color = (millis() / 250) % 2 ? C_BLUE : C_WHIT;
-  else {
-    switch (ghost.type) {
-    case 0:
-      color = C_RED;
-      break;
-    case 1:
-      color = C_PINK;
-      break;
-    case 2:
-      color = C_CYAN;
-      break;
-    case 3:
-      color = C_ORNG;
-      break;
-    }
-  }
+void GameEngine::drawGhost(const DisplayItem &item, int offsetY) {
+  const Ghost &ghost = *(const Ghost *)item.data;
+  uint16_t color = item.color;
+  int screenX = item.x;
+  int screenY = item.y - offsetY;
   int centerX = screenX + TILE_SIZE / 2;
   int centerY = screenY + TILE_SIZE / 2;
   int radius = TILE_SIZE / 2 - 1;
-  _canvas->fillCircle(centerX, centerY - 2, radius, color);
-  _canvas->fillRect(screenX + 2, centerY - 2, TILE_SIZE - 4, radius + 2, color);
-  for (int i = 0; i < 3; i++) {
-    int footX = screenX + 2 + i * 7;
-    _canvas->fillTriangle(footX, screenY + TILE_SIZE - 2, footX + 3,
-                          screenY + TILE_SIZE + 2, footX + 6,
-                          screenY + TILE_SIZE - 2, color);
+  if (!ghost.eaten) { // Eaten ghosts are just eyes on their way home
+    _canvas->fillCircle(centerX, centerY - 2, radius, color);
+    _canvas->fillRect(screenX + 2, centerY - 2, TILE_SIZE - 4, radius + 2,
+                      color);
+    for (int i = 0; i < 3; i++) {
+      int footX = screenX + 2 + i * 7;
+      _canvas->fillTriangle(footX, screenY + TILE_SIZE - 2, footX + 3,
+                            screenY + TILE_SIZE + 2, footX + 6,
+                            screenY + TILE_SIZE - 2, color);
+    }
   }
 
   _canvas->fillCircle(centerX - 4, centerY - 2, 4, C_WHIT);
@@ -1003,12 +1144,14 @@ void GameEngine::drawGhost(const Ghost &ghost, int offsetY) {
 }
 
 void GameEngine::drawHUD(int offsetY) {
-  _canvas->setTextFont(2);
-  _canvas->setTextDatum(TL_DATUM);
-
   // Draw HUD on the right side (x > 418)
   int hudX = 425;
 
+  // Text fields are pre-rendered bitmaps, clipped to the band
+  _hudScoreLabel.draw(_canvas, hudX, 40 - offsetY);
+  _hudScore.draw(_canvas, hudX, 60 - offsetY);
+  _hudLivesLabel.draw(_canvas, hudX, 100 - offsetY);
+
   // Helper lambda to draw if visible in current strip
   auto drawIfVisible = [&](int y, int h, std::function<void(int)> drawFn) {
     if (y + h > offsetY && y < offsetY + 32) {
@@ -1016,24 +1159,6 @@ void GameEngine::drawHUD(int offsetY) {
     }
   };
 
-  // Score Label (Y=40, H=20)
-  drawIfVisible(40, 20, [&](int localY) {
-    _canvas->setTextColor(C_WHIT);
-    _canvas->drawString("SCORE", hudX, localY);
-  });
-
-  // Score Value (Y=60, H=20)
-  drawIfVisible(60, 20, [&](int localY) {
-    _canvas->setTextColor(C_WHIT);
-    _canvas->drawString(String(_score), hudX, localY);
-  });
-
-  // Lives Label (Y=100, H=20)
-  drawIfVisible(100, 20, [&](int localY) {
-    _canvas->setTextColor(C_WHIT);
-    _canvas->drawString("LIVES", hudX, localY);
-  });
-
   // Lives Icons (Y=130, H=60 for 3 lives) - Shifted down to 130
   drawIfVisible(130, 60, [&](int localY) {
     for (int i = 0; i < _lives; i++) {
@@ -1062,7 +1187,7 @@ void GameEngine::drawMenu(int offsetY) {
       int screenY = MAZE_OFFSET_Y + y * TILE_SIZE - offsetY;
       if (screenY < -TILE_SIZE || screenY >= 32)
         continue;
-      if (_maze[y][x] == 1)
+      if (_tiles[y][x] & TILE_WALL)
         _canvas->drawRect(screenX, screenY, TILE_SIZE, TILE_SIZE, wallColor);
     }
   }
@@ -1238,32 +1363,11 @@ void GameEngine::drawShop(int offsetY) {
       int previewY = boxY + 20;
       if (previewY >= -30 && previewY < 32) {
         if (isSkin) {
-          uint16_t skinColor = C_YELL;
-          if (itemIndex == 1)
-            skinColor = C_PINK;
-          else if (itemIndex == 2)
-            skinColor = C_CYAN;
-          else if (itemIndex == 3)
-            skinColor = C_GREN;
-          else if (itemIndex == 4)
-            skinColor = 0xF800;
-          else if (itemIndex == 5)
-            skinColor = 0x7E0;
-          else if (itemIndex == 6)
-            skinColor = 0x001F;
-          else if (itemIndex == 7)
-            skinColor = 0xFFFF;
-          _canvas->fillCircle(boxX + boxWidth / 2, previewY, 14, skinColor);
+          _canvas->fillCircle(boxX + boxWidth / 2, previewY, 14,
+                              pacman_skin_colors[itemIndex]);
         } else {
-          uint16_t wallColor = C_BLUE;
-          if (itemIndex == 1)
-            wallColor = 0xD820;
-          else if (itemIndex == 2)
-            wallColor = 0x3540;
-          else if (itemIndex == 3)
-            wallColor = 0xFD20;
           _canvas->drawRect(boxX + boxWidth / 2 - 15, previewY - 15, 30, 30,
-                            wallColor);
+                            maze_themes[itemIndex].wall);
         }
       }
       // Price / Status
@@ -1285,48 +1389,13 @@ void GameEngine::drawShop(int offsetY) {
 }
 
 bool GameEngine::isValidMove(int x, int y, Direction dir) {
-  int nx = x, ny = y;
-  switch (dir) {
-  case DIR_UP:
-    ny--;
-    break;
-  case DIR_DOWN:
-    ny++;
-    break;
-  case DIR_LEFT:
-    nx--;
-    break;
-  case DIR_RIGHT:
-    nx++;
-    break;
-  default:
-    return false;
-  }
-  if (nx < 0 || nx >= MAZE_WIDTH || ny < 0 || ny >= MAZE_HEIGHT)
-    return false;
-  if (_maze[ny][nx] == 1)
-    return false; // Wall
-  if (_maze[ny][nx] == 4)
-    return false; // Cage (Pacman cannot enter)
-  return true;
+  return dir < DIR_NONE && (_tiles[y][x] & (1 << dir));
 }
 
 Position GameEngine::getNextPosition(Position pos, Direction dir) {
-  Position next = pos;
-  switch (dir) {
-  case DIR_UP:
-    next.y--;
-    break;
-  case DIR_DOWN:
-    next.y++;
-    break;
-  case DIR_LEFT:
-    next.x--;
-    break;
-  case DIR_RIGHT:
-    next.x++;
-    break;
-  }
+  if (dir >= DIR_NONE)
+    return pos;
+  Position next = {pos.x + DIR_DX[dir], pos.y + DIR_DY[dir]};
   if (next.x < 0)
     next.x = MAZE_WIDTH - 1;
   else if (next.x >= MAZE_WIDTH)
@@ -1353,4 +1422,82 @@ int GameEngine::manhattanDistance(Position a, Position b) {
   return abs(a.x - b.x) + abs(a.y - b.y);
 }
 
-void GameEngine::returnToMenu() { ::returnToMenu(); }
+void GameEngine::loadGameData() {
+  if (!save.begin("pacman"))
+    migrateSave();
+  const PacManSave &data = save.get();
+  _highScore = data.highScore;
+  _totalCoins = data.totalCoins;
+  _selectedSkin = data.skin;
+  _selectedTheme = data.theme;
+  for (int i = 0; i < 8; i++)
+    _ownedSkins[i] = data.ownedSkins & (1 << i);
+  for (int i = 0; i < 4; i++)
+    _ownedThemes[i] = data.ownedThemes & (1 << i);
+}
+
+// Only marks the record dirty when something changed; flushing is up to
+// saveBehind()
+void GameEngine::saveGameData() {
+  PacManSave data = {};
+  data.highScore = _highScore;
+  data.totalCoins = _totalCoins;
+  data.skin = _selectedSkin;
+  data.theme = _selectedTheme;
+  for (int i = 0; i < 8; i++)
+    data.ownedSkins |= _ownedSkins[i] << i;
+  for (int i = 0; i < 4; i++)
+    data.ownedThemes |= _ownedThemes[i] << i;
+  save.set(data);
+}
+
+// Before the single record every value had its own key. Their values move
+// into the record and, once it is written, the keys are removed.
+void GameEngine::migrateSave() {
+  Preferences &old = save.prefs();
+  PacManSave data = {};
+  data.highScore = old.getInt("highScore", 0);
+  data.totalCoins = old.getInt("totalCoins", 0);
+  data.skin = old.getInt("skin", 0);
+  data.theme = old.getInt("theme", 0);
+  for (int i = 0; i < 8; i++)
+    if (old.getBool(("skin_" + String(i)).c_str(), i == 0))
+      data.ownedSkins |= 1 << i;
+  for (int i = 0; i < 4; i++)
+    if (old.getBool(("theme_" + String(i)).c_str(), i == 0))
+      data.ownedThemes |= 1 << i;
+  save.set(data);
+  save.flush();
+  if (save.dirty())
+    return; // Keep the keys, try again next boot
+
+  Serial.println("Save migrated to a single record");
+  const char *keys[] = {"highScore", "totalCoins", "skin", "theme"};
+  for (const char *key : keys)
+    old.remove(key);
+  for (int i = 0; i < 8; i++)
+    old.remove(("skin_" + String(i)).c_str());
+  for (int i = 0; i < 4; i++)
+    old.remove(("theme_" + String(i)).c_str());
+}
+
+// Writes pending saves whenever play has stopped. Coins picked up during
+// play stay in RAM until then, so no gameplay frame waits on flash.
+void GameEngine::saveBehind() {
+  if (_state == STATE_PLAYING) {
+    _savedState = _state;
+    return;
+  }
+  saveGameData();
+  if (_state != _savedState)
+    save.flush(); // Paused, game over, won or back in the menu
+  else
+    save.flushIfDue(SAVE_DELAY_MS);
+  _savedState = _state;
+}
+
+void GameEngine::returnToMenu() {
+  saveGameData();
+  save.flush(); // The launcher restarts the chip
+  ::returnToMenu();
+}
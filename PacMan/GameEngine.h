@@ -2,11 +2,14 @@
 #define GAME_ENGINE_H
 
 #include "Assets.h"
+#include "DisplayList.h"
+#include "DistanceField.h"
+#include "Hud.h"
 #include "Input.h"
+#include "RenderPipeline.h"
+#include "SaveStore.h"
 #include <Arduino.h>
-#include <Preferences.h>
 #include <TFT_eSPI.h>
-#include <vector>
 
 enum GameState {
   STATE_MENU,
@@ -18,6 +21,18 @@ enum GameState {
 };
 
 enum Direction { DIR_UP, DIR_DOWN, DIR_LEFT, DIR_RIGHT, DIR_NONE };
+static const int8_t DIR_DX[4] = {0, 0, -1, 1};
+static const int8_t DIR_DY[4] = {-1, 1, 0, 0};
+
+// One byte per maze tile. The low nibble holds the directions a move can
+// take from the tile (bit 1 << Direction), worked out once by loadMaze.
+enum TileBits : uint8_t {
+  TILE_EXITS = 0x0F,
+  TILE_WALL = 0x10,
+  TILE_DOT = 0x20,
+  TILE_PELLET = 0x40,
+  TILE_CAGE = 0x80 // Ghosts only
+};
 
 struct Position {
   int x, y;
@@ -30,23 +45,23 @@ struct Ghost {
   Direction dir;
   int type;
   bool frightened;
-  bool eaten;
-  unsigned long deadTime;
+  bool eaten; // Eyes only, walking back to the cage
 };
 
-class GameEngine {
-public:
-  GameEngine(TFT_eSPI *tft, Input *input);
-  void init();
-  void update(float dt);
-  void draw();
-
-private:
-  TFT_eSPI *_tft;
-  Input *_input;
-  TFT_eSprite *_canvas;
-  bool _useSprite;
+// Everything kept across power cycles, stored as one record (SaveStore)
+struct PacManSave {
+  int32_t highScore;
+  int32_t totalCoins;
+  uint8_t ownedSkins;  // Bit i: skin i bought
+  uint8_t ownedThemes; // Bit i: theme i bought
+  uint8_t skin;
+  uint8_t theme;
+};
 
+// Everything draw() reads. The engine keeps it as a base so game code uses
+// the fields directly; in dual-core mode the simulation copies it into a
+// snapshot after its ticks and the render-side engine draws from a copy.
+struct RenderState {
   GameState _state;
   int _score;
   int _highScore;
@@ -60,27 +75,76 @@ private:
   Position _pacman;
   Position _prevPacman;
   Direction _pacmanDir;
-  Direction _nextDir;
   float _animFrame;
   bool _mouthOpen;
   float _moveTimer;
 
   // Ghosts
-  std::vector<Ghost> _ghosts;
+  static const int NUM_GHOSTS = 4;
+  Ghost _ghosts[NUM_GHOSTS];
   float _ghostMoveTimer;
 
+  // Maze (17x13 for 24px tiles)
+  uint8_t _tiles[13][17]; // TileBits
+  int _dotsLeft;          // Dots and power pellets still on the maze
+  uint16_t _mazeVersion; // Bumped by loadMaze, tells draw to start over
+
+  unsigned long _frightenedStart;
+  bool _frightenedMode;
+  int _frightenedTime;
+
+  // Shop system
+  int _selectedSkin;
+  int _selectedTheme;
+  bool _ownedSkins[8];  // Increased to 8 skins
+  bool _ownedThemes[4]; // 4 themes
+  int _shopScrollOffset;
+
+  // Navegación con joystick
+  int _selectedMenuItem;    // 0=Jugar, 1=Tienda, 2=Salir
+  int _selectedShopItem;    // 0-11 para items de tienda (8 skins + 4 themes)
+  int _selectedPauseOption; // 0=Resume, 1=Menu
+};
+
+class GameEngine : private RenderState {
+public:
+  // Simulation tick and render target for LoopDriver
+  static const int TICK_HZ = 120;
+  static const int RENDER_HZ = 60;
+
+  GameEngine(TFT_eSPI *tft, Input *input);
+  void init(); // initSimulation() + initRender()
+  void initSimulation();
+  void initRender();
+  void update(float dt);
+  void draw(float alpha); // alpha: fraction of a tick since the last update
+  const PipelineStats &getPipelineStats() const { return _pipeline.stats(); }
+  uint32_t getPushedBytes() const { return _pipeline.stats().bytes; }
+
+  // Dual-core mode: copy the state out after ticking / into the render-side
+  // engine before drawing
+  void snapshot(RenderState &out) const { out = *this; }
+  void applySnapshot(const RenderState &state) {
+    RenderState::operator=(state);
+  }
+
+private:
+  TFT_eSPI *_tft;
+  Input *_input;
+  RenderPipeline _pipeline;
+  TFT_eSprite *_canvas; // Strip buffer currently being drawn
+  bool _useSprite;
+
+  // Player
+  Direction _nextDir;
+
   // Maze (17x13 for 24px tiles)
   static const int MAZE_WIDTH = 17;
   static const int MAZE_HEIGHT = 13;
-  int _maze[13][17];
-  std::vector<Position> _dots;
-  std::vector<Position> _powerPellets;
+  DistanceField<MAZE_WIDTH, MAZE_HEIGHT, 128> _paths; // Rebuilt by loadMaze
 
   // Game timers
   unsigned long _gameStartTime;
-  unsigned long _frightenedStart;
-  bool _frightenedMode;
-  int _frightenedTime;
 
   // Control
   bool _clickDebounce;
@@ -91,22 +155,41 @@ private:
   bool _isTouching;
 
   // Shop system
-  int _selectedSkin;
-  int _selectedTheme;
-  bool _ownedSkins[8];  // Increased to 8 skins
-  bool _ownedThemes[4]; // 4 themes
-  int _shopScrollOffset;
-  int _lastJoystickDir;
-  unsigned long _lastJoystickTime;
   int _lastTouchY; // Para el scroll
   bool _touchJustStarted;
 
-  // Navegación con joystick
-  int _selectedMenuItem;    // 0=Jugar, 1=Tienda, 2=Salir
-  int _selectedShopItem;    // 0-11 para items de tienda (8 skins + 4 themes)
-  int _selectedPauseOption; // 0=Resume, 1=Menu
-  unsigned long _lastJoystickMenuTime;
-  bool _joystickMenuMoved;
+  // Saves: flushed when play stops, or SAVE_DELAY_MS after a change in the
+  // menus
+  static const uint32_t SAVE_DELAY_MS = 2000;
+  GameState _savedState; // State at the last saveBehind()
+
+  // Damage tracking (gameplay): one bit per maze column for each maze row
+  struct TileRect {
+    int x0, y0, x1, y1;
+  };
+  uint32_t _dirtyTiles[13];
+  TileRect _lastActorRects[5]; // Pac-Man + ghosts as drawn last frame
+  uint16_t _drawnMazeVersion;  // Maze drawn in full last; else redraw
+  GameState _lastDrawnState;
+  int _lastHudScore;
+  int _lastHudLives;
+  int _pelletPulse; // Sampled once per frame so every strip agrees
+  int _lastPelletPulse;
+
+  // Static maze layer (PSRAM): walls for the current maze and theme,
+  // re-baked on loadMaze or theme change. Null if it couldn't be allocated.
+  TFT_eSprite *_mazeLayer;
+  uint16_t _bakedMazeVersion;
+  int _bakedTheme;
+
+  // HUD text, rasterized only when it changes
+  HudField _hudScoreLabel;
+  HudField _hudScore;
+  HudField _hudLivesLabel;
+
+  // Actors resolved once per frame (interpolated position, color)
+  enum DisplayKind : uint8_t { DL_PACMAN, DL_GHOST };
+  DisplayList<8, 10> _displayList;
 
   void startGame();
   void resetLevel();
@@ -131,13 +214,28 @@ private:
   void nextLevel();
   void gameOver();
   void returnToMenu();
+  void saveBehind();
+  void loadGameData();
+  void saveGameData();
+  void migrateSave();
   void drawShop(int offsetY);
 
   // Drawing functions
+  ViewKey viewKey() const;
+  void drawFull();
+  void drawDamaged();
+  void drawPlayfield(int offsetY);
+  void pushHudRegion(int y, int h);
+  TileRect getActorTiles(Position prev, Position cur, int pad);
+  void markTiles(const TileRect &r);
+  void bakeMaze();
+  void drawMazeLayer(int offsetY);
+  void drawWalls(TFT_eSprite *dst, int offsetY, int height);
   void drawMaze(int offsetY);
-  void drawPacman(int offsetY);
-  void drawGhosts(int offsetY);
-  void drawGhost(const Ghost &ghost, int offsetY);
+  void buildDisplayList(float alpha);
+  void drawActors(int offsetY, int height);
+  void drawPacman(const DisplayItem &item, int offsetY);
+  void drawGhost(const DisplayItem &item, int offsetY);
   void drawHUD(int offsetY);
   void drawMenu(int offsetY);
   void drawPauseMenu(int offsetY);
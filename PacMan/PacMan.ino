@@ -1,5 +1,7 @@
 #include "GameEngine.h"
 #include "Input.h"
+#include "LoopDriver.h"
+#include "TripleBuffer.h"
 #include <Arduino.h>
 #include <SPI.h>
 #include <TFT_eSPI.h>
@@ -11,7 +13,46 @@ TFT_eSPI tft = TFT_eSPI();
 Input input;
 GameEngine engine(&tft, &input);
 
-unsigned long lastTime = 0;
+LoopDriver loopDriver(GameEngine::TICK_HZ, GameEngine::RENDER_HZ);
+
+// 1: simulation task on core 0 and rendering (SPI) task on core 1, handing
+// over state snapshots; 0: update and draw in turn from loop()
+#define DUAL_CORE 0
+
+#if DUAL_CORE
+// Render-side engine: never ticks, draws the newest published snapshot
+GameEngine view(&tft, &input);
+
+struct Snapshot {
+  RenderState state;
+  uint32_t tickTime; // micros() when published
+};
+TripleBuffer<Snapshot> snapshots;
+
+void publishSnapshot() {
+  Snapshot &snap = snapshots.back();
+  engine.snapshot(snap.state);
+  snap.tickTime = micros();
+  snapshots.publish();
+}
+
+void simTask(void *) {
+  for (;;) {
+    if (loopDriver.runTicks([](float dt) { engine.update(dt); }))
+      publishSnapshot();
+  }
+}
+
+void renderTask(void *) {
+  for (;;) {
+    loopDriver.runRenders([]() {
+      if (snapshots.acquire())
+        view.applySnapshot(snapshots.front().state);
+      view.draw(loopDriver.alphaSince(snapshots.front().tickTime));
+    });
+  }
+}
+#endif
 
 void setup() {
   Serial.begin(115200);
@@ -28,19 +69,26 @@ void setup() {
   input.begin();
 
   // Init Game Engine
+#if DUAL_CORE
+  engine.initSimulation();
+  view.initRender();
+  publishSnapshot();
+#else
   engine.init();
+#endif
 
-  lastTime = millis();
+  loopDriver.begin();
+#if DUAL_CORE
+  xTaskCreatePinnedToCore(simTask, "sim", 8192, nullptr, 1, nullptr, 0);
+  xTaskCreatePinnedToCore(renderTask, "render", 8192, nullptr, 1, nullptr, 1);
+#endif
 }
 
 void loop() {
-  unsigned long now = millis();
-  float dt = (now - lastTime) / 1000.0f;
-  lastTime = now;
-
-  if (dt > 0.1f)
-    dt = 0.1f;
-
-  engine.update(dt);
-  engine.draw();
+#if DUAL_CORE
+  vTaskDelete(nullptr); // simTask and renderTask do the work
+#else
+  loopDriver.run([](float dt) { engine.update(dt); },
+                 [](float alpha) { engine.draw(alpha); });
+#endif
 }
\ No newline at end of file
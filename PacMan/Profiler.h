@@ -0,0 +1,212 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <esp_timer.h>
+
+// On in every build: recording is cheap and the overlay only shows when
+// toggled at runtime (Input's A+B chord). 0 compiles it out entirely; set
+// it as a build flag (-DPROFILER_ENABLED=0) so every file agrees, never
+// with a #define in one file.
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+#define PROFILER_OVERLAY_MS 500 // Overlay numbers refresh period
+
+enum ProfilePhase {
+  PROF_INPUT,  // Input::getTouch / getJoystick
+  PROF_UPDATE, // One GameEngine::update tick, input reads included
+  PROF_DRAW,   // Drawing one strip (or region) into its buffer
+  PROF_PUSH,   // Sending one strip, region or framebuffer diff
+  PROF_FRAME,  // One whole GameEngine::draw, pushes included
+  PROF_SAVE,   // One SaveStore::flush, i.e. one flash write
+  PROF_PHASES
+};
+
+// Durations in microseconds. Exact below 16 us, then 4 buckets per power of
+// two (values within ~12%). All counts are halved when the total reaches
+// DECAY_AT, so percentiles follow roughly the last few thousand samples.
+struct ProfileHistogram {
+  static const int BUCKETS = 96;
+  static const uint16_t DECAY_AT = 4096;
+
+  uint16_t counts[BUCKETS];
+  uint16_t total;
+  uint32_t max; // Since the last reset, not decayed
+
+  void add(uint32_t us) {
+    counts[bucketOf(us)]++;
+    if (us > max)
+      max = us;
+    if (++total >= DECAY_AT) {
+      total = 0;
+      for (int i = 0; i < BUCKETS; i++) {
+        counts[i] >>= 1;
+        total += counts[i];
+      }
+    }
+  }
+
+  // Representative value of the bucket holding the pct-th percentile
+  uint32_t percentile(int pct) const {
+    uint32_t rank = ((uint32_t)total * pct + 99) / 100;
+    uint32_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++) {
+      seen += counts[i];
+      if (seen >= rank && seen > 0)
+        return bucketValue(i);
+    }
+    return 0;
+  }
+
+  static int bucketOf(uint32_t us) {
+    if (us < 16)
+      return us;
+    int octave = 31 - __builtin_clz(us); // >= 4
+    int b = 16 + (octave - 4) * 4 + ((us >> (octave - 2)) & 3);
+    return b < BUCKETS ? b : BUCKETS - 1;
+  }
+
+  static uint32_t bucketValue(int b) {
+    if (b < 16)
+      return b;
+    int octave = (b - 16) / 4 + 4;
+    uint32_t low = (uint32_t)(4 + (b - 16) % 4) << (octave - 2);
+    return low + (1u << (octave - 3)); // Middle of the bucket
+  }
+};
+
+// Per-phase timing histograms, cheap enough to leave on: a sample is two
+// esp_timer_get_time() calls and a bucket increment. Each phase is only
+// recorded from one task, so the dual-core split needs no locking.
+//
+// Dumped with 'p' over serial (LoopDriver), cleared with 'r'. The overlay
+// is drawn by the RenderPipeline into the bottom of the last strip.
+class Profiler {
+public:
+  static void record(ProfilePhase phase, uint32_t us) {
+    if (PROFILER_ENABLED)
+      data().hist[phase].add(us);
+  }
+
+  static void reset() {
+    if (PROFILER_ENABLED)
+      memset(data().hist, 0, sizeof(data().hist));
+  }
+
+  static void print() {
+    if (!PROFILER_ENABLED)
+      return;
+    Serial.println("Profile (us)      n    p50    p95    p99    max");
+    for (int i = 0; i < PROF_PHASES; i++) {
+      const ProfileHistogram &h = data().hist[i];
+      Serial.printf("%-10s %6u %6lu %6lu %6lu %6lu\n", phaseName(i), h.total,
+                    (unsigned long)h.percentile(50),
+                    (unsigned long)h.percentile(95),
+                    (unsigned long)h.percentile(99), (unsigned long)h.max);
+    }
+  }
+
+  // Debounced A+B chord state from Input::poll(): pressing the chord
+  // toggles the overlay
+  static void chord(bool held) {
+    if (!PROFILER_ENABLED)
+      return;
+    Data &d = data();
+    if (held && !d.chord)
+      d.overlay = !d.overlay;
+    d.chord = held;
+  }
+
+  // Called once per loop pass: rebuilds the overlay text every
+  // PROFILER_OVERLAY_MS while it is shown
+  static void poll() {
+    if (!PROFILER_ENABLED)
+      return;
+    Data &d = data();
+    if (!d.overlay || millis() - d.refreshed < PROFILER_OVERLAY_MS)
+      return;
+    d.refreshed = millis();
+    d.stamp += 2;
+    for (int i = 0; i < PROF_PHASES; i++) {
+      const ProfileHistogram &h = d.hist[i];
+      snprintf(d.text[i], sizeof(d.text[i]), "%s %lu/%lu/%lu/%lu",
+               phaseName(i), (unsigned long)h.percentile(50),
+               (unsigned long)h.percentile(95),
+               (unsigned long)h.percentile(99), (unsigned long)h.max);
+    }
+  }
+
+  static bool overlayVisible() { return PROFILER_ENABLED && data().overlay; }
+
+  // Changes whenever the overlay appears, disappears or gets new numbers;
+  // 0 while hidden. Lets renderers that skip unchanged strips notice it.
+  static uint32_t overlayStamp() {
+    return overlayVisible() ? data().stamp | 1 : 0;
+  }
+
+  static const int OVERLAY_H = 20;
+
+  // Draws the overlay over the bottom rows of a strip (no viewport)
+  static void drawOverlay(TFT_eSprite *strip, int stripH) {
+    if (!overlayVisible())
+      return;
+    Data &d = data();
+    int top = stripH - OVERLAY_H;
+    strip->fillRect(0, top, strip->width(), OVERLAY_H, TFT_BLACK);
+    strip->setTextSize(1);
+    strip->setTextDatum(TL_DATUM);
+    strip->setTextColor(TFT_GREEN, TFT_BLACK);
+    for (int i = 0; i < PROF_PHASES; i++)
+      strip->drawString(d.text[i], 2 + (i % 3) * 160, top + 2 + (i / 3) * 10,
+                        1);
+  }
+
+private:
+  struct Data {
+    ProfileHistogram hist[PROF_PHASES];
+    bool overlay;
+    bool chord;
+    uint32_t refreshed;
+    uint32_t stamp;
+    char text[PROF_PHASES][32];
+  };
+
+  // Function-local static: one instance shared by every file including this
+  static Data &data() {
+    static Data d;
+    return d;
+  }
+
+  static const char *phaseName(int phase) {
+    static const char *const names[PROF_PHASES] = {
+        "input", "update", "draw", "push", "frame", "save"};
+    return names[phase];
+  }
+};
+
+// Times the rest of the enclosing block
+class ProfileScope {
+public:
+  ProfileScope(ProfilePhase phase)
+      : _phase(phase), _start(esp_timer_get_time()) {}
+  ~ProfileScope() {
+    Profiler::record(_phase, (uint32_t)(esp_timer_get_time() - _start));
+  }
+
+private:
+  ProfilePhase _phase;
+  int64_t _start;
+};
+
+#if PROFILER_ENABLED
+#define PROFILE_SCOPE(phase) ProfileScope _profileScope(phase)
+#define PROFILE_RECORD(phase, us) Profiler::record(phase, us)
+#else
+#define PROFILE_SCOPE(phase)
+#define PROFILE_RECORD(phase, us)
+#endif
+
+#endif
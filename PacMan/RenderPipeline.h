@@ -0,0 +1,373 @@
+#ifndef RENDER_PIPELINE_H
+#define RENDER_PIPELINE_H
+
+#include "Profiler.h"
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <esp_heap_caps.h>
+
+// Timing of one frame through the pipeline
+struct PipelineStats {
+  uint32_t renderUs; // Drawing into strip buffers
+  uint32_t waitUs;   // Blocked on SPI (DMA completion or blocking push)
+  uint16_t strips;   // Strips, regions or framebuffer windows pushed
+  uint32_t bytes;    // Pixel bytes sent to the panel
+};
+
+enum RenderMode {
+  RENDER_STRIPS,     // Strip buffers in internal RAM, pushed whole
+  RENDER_FRAMEBUFFER // Full frame in PSRAM, only changed spans pushed
+};
+
+// FNV-1a over the values a screen is drawn from (selection, scroll, blink
+// phase...). Two equal keys mean the screen would come out the same.
+class ViewKey {
+public:
+  ViewKey() : _h(2166136261u) {}
+
+  ViewKey &mix(uint32_t v) {
+    for (int i = 0; i < 4; i++) {
+      _h = (_h ^ (v & 0xFF)) * 16777619u;
+      v >>= 8;
+    }
+    return *this;
+  }
+
+  uint32_t value() const { return _h; }
+
+private:
+  uint32_t _h;
+};
+
+// Renders the screen as horizontal strips. With two buffers in DMA-capable
+// RAM, strip N+1 is drawn while strip N is still being sent by
+// pushImageDMA; otherwise a single buffer is pushed blocking.
+//
+// In framebuffer mode the single "strip" is the whole screen in PSRAM. A
+// copy of the last pushed frame is kept and presenting a frame sends only
+// the row spans that differ from it.
+//
+// Draw code works in fixed-height bands (what the engines' visibility checks
+// are written against). A strip holds one or more bands and each band is
+// selected as a sprite viewport, so drawing is offset and clipped into it.
+class RenderPipeline {
+public:
+  static const int MAX_STRIP_ROWS = 80;
+  // Unchanged pixels between two changed ones are sent anyway below this
+  // gap; a new address window costs about as much as 8 pixels.
+  static const int SPAN_MERGE_GAP = 8;
+  static const int MAX_ROW_SPANS = 8;
+
+  RenderPipeline(TFT_eSPI *tft)
+      : _tft(tft), _count(0), _current(0), _dma(false), _width(0),
+        _bandH(0), _stripH(0), _screenH(0), _rendering(false), _mark(0),
+        _frameKey(0), _shownKey(0), _prev(nullptr),
+        _fullPush(false), _win{0, 0, 0, 0} {
+    _buffers[0] = nullptr;
+    _buffers[1] = nullptr;
+    _frame = {0, 0, 0, 0};
+    _stats = {0, 0, 0, 0};
+  }
+
+  // Picks the tallest strip (whole bands dividing the screen) of which two
+  // fit in half of the largest free DMA block, then creates the buffers.
+  // RENDER_FRAMEBUFFER falls back to strips when PSRAM is missing.
+  bool begin(int width, int bandHeight, int screenHeight,
+             RenderMode mode = RENDER_STRIPS) {
+    _width = width;
+    _bandH = bandHeight;
+    _screenH = screenHeight;
+
+    if (mode == RENDER_FRAMEBUFFER) {
+      if (createFramebuffer(screenHeight)) {
+        Serial.printf("Render pipeline: %dx%d framebuffer in PSRAM\n", width,
+                      screenHeight);
+        return true;
+      }
+      Serial.println("Render pipeline: no PSRAM framebuffer, using strips");
+    }
+
+    size_t bandBytes = (size_t)width * bandHeight * 2;
+    size_t budget = heap_caps_get_largest_free_block(MALLOC_CAP_DMA) / 2;
+    int bands = screenHeight / bandHeight;
+    int perStrip = 1;
+    for (int n = bands; n > 1; n--) {
+      if (bands % n == 0 && n * bandHeight <= MAX_STRIP_ROWS &&
+          2 * n * bandBytes <= budget) {
+        perStrip = n;
+        break;
+      }
+    }
+
+    createBuffers(perStrip * bandHeight, false);
+    if (_count == 0 && perStrip > 1)
+      createBuffers(bandHeight, false);
+    if (_count == 0)
+      createBuffers(bandHeight, true); // Last resort: one PSRAM strip
+    if (_count == 0)
+      return false;
+
+    _dma = _count == 2 && _tft->initDMA();
+    Serial.printf("Render pipeline: %d lines x %d buffer(s), DMA %s\n",
+                  _stripH, _count, _dma ? "on" : "off");
+    return true;
+  }
+
+  int stripHeight() const { return _stripH; }
+  bool framebuffer() const { return _prev != nullptr; }
+  int bufferCount() const { return _count; }
+  TFT_eSprite *buffer(int i) { return _buffers[i]; }
+  const PipelineStats &stats() const { return _stats; }
+
+  // Static screens: true if the frame on screen was drawn from the same key,
+  // so the caller can skip drawing and pushing it. Otherwise the key is
+  // remembered for the frame about to be drawn; frames drawn without a key
+  // (gameplay) forget it.
+  bool unchanged(const ViewKey &key) {
+    ViewKey k = key;
+    uint32_t value = k.mix(Profiler::overlayStamp()).value() | 1; // 0: none
+    if (value == _shownKey)
+      return true;
+    _frameKey = value;
+    return false;
+  }
+
+  void beginFrame() {
+    _shownKey = _frameKey;
+    _frameKey = 0;
+    _frame = {0, 0, 0, 0};
+    if (_dma)
+      _tft->startWrite();
+  }
+
+  // Returns the buffer for the next strip. With DMA the other buffer may
+  // still be in flight; this one finished before the last push started.
+  TFT_eSprite *beginStrip() {
+    if (_count > 1)
+      _current ^= 1;
+    _rendering = true;
+    _mark = micros();
+    return _buffers[_current];
+  }
+
+  // Clips and offsets drawing to the band starting at this strip row
+  void selectBand(int row) {
+    _buffers[_current]->setViewport(0, row, _width, _bandH);
+  }
+
+  // Sends the whole current strip to screen row y. Sprite buffers are
+  // already in panel byte order, so the TFT must not swap bytes.
+  void pushStrip(int y) {
+    TFT_eSprite *strip = _buffers[_current];
+    endRender();
+    strip->resetViewport();
+    if (y + _stripH >= _screenH)
+      Profiler::drawOverlay(strip, _stripH);
+    if (_prev) {
+      presentFrame();
+      return;
+    }
+    uint32_t start = micros();
+    if (_dma) {
+      _tft->dmaWait();
+      _frame.waitUs += micros() - start;
+      // With swapBytes set pushImageDMA would swap the strip in place
+      // before sending it. Sprite pixels are already in panel order.
+      bool swap = _tft->getSwapBytes();
+      _tft->setSwapBytes(false);
+      _tft->pushImageDMA(0, y, _width, _stripH,
+                         (uint16_t *)strip->getPointer());
+      _tft->setSwapBytes(swap);
+    } else {
+      strip->pushSprite(0, y);
+      _frame.waitUs += micros() - start;
+    }
+    PROFILE_RECORD(PROF_PUSH, micros() - start);
+    _frame.strips++;
+    _frame.bytes += _width * _stripH * 2;
+  }
+
+  // Pushes a window of the current strip to (x, y), blocking
+  void pushRegion(int x, int y, int sx, int sy, int w, int h) {
+    TFT_eSprite *strip = _buffers[_current];
+    endRender();
+    strip->resetViewport();
+    uint32_t start = micros();
+    if (_dma)
+      _tft->dmaWait();
+    strip->pushSprite(x, y, sx, sy, w, h);
+    _frame.waitUs += micros() - start;
+    PROFILE_RECORD(PROF_PUSH, micros() - start);
+    _frame.strips++;
+    _frame.bytes += w * h * 2;
+  }
+
+  void endFrame() {
+    if (_dma) {
+      uint32_t start = micros();
+      _tft->dmaWait();
+      _frame.waitUs += micros() - start;
+      _tft->endWrite();
+    }
+    _stats = _frame;
+  }
+
+private:
+  TFT_eSPI *_tft;
+  TFT_eSprite *_buffers[2];
+  int _count;
+  int _current;
+  bool _dma;
+  int _width;
+  int _bandH;
+  int _stripH;
+  int _screenH;
+  bool _rendering;
+  uint32_t _mark;
+  uint32_t _frameKey; // Key passed to unchanged() for the coming frame
+  uint32_t _shownKey; // Key of the frame on screen, 0 if it had none
+  PipelineStats _frame;
+  PipelineStats _stats;
+
+  // Framebuffer mode: last pushed frame and the address window being built
+  // from consecutive rows that changed over the same span
+  uint16_t *_prev;
+  bool _fullPush;
+  struct Window {
+    int x, y, w, h;
+  } _win;
+
+  bool createFramebuffer(int screenHeight) {
+    if (!psramFound())
+      return false;
+    TFT_eSprite *frame = new TFT_eSprite(_tft);
+    frame->setColorDepth(16);
+    frame->setAttribute(PSRAM_ENABLE, true);
+    size_t bytes = (size_t)_width * screenHeight * 2;
+    _prev = (uint16_t *)ps_malloc(bytes);
+    if (!_prev || !frame->createSprite(_width, screenHeight)) {
+      free(_prev);
+      _prev = nullptr;
+      delete frame;
+      return false;
+    }
+    _buffers[0] = frame;
+    _count = 1;
+    _stripH = screenHeight;
+    _fullPush = true; // Panel content is unknown until the first push
+    return true;
+  }
+
+  // Diffs every row against the last pushed frame and sends the changed
+  // spans. Rows changing over the same single span share one window.
+  void presentFrame() {
+    uint16_t *cur = (uint16_t *)_buffers[0]->getPointer();
+    uint32_t start = micros();
+    bool swap = _tft->getSwapBytes();
+    _tft->setSwapBytes(false); // Sprite pixels are already in panel order
+    _tft->startWrite();
+
+    _win = {0, 0, 0, 0};
+    int spanX[MAX_ROW_SPANS], spanW[MAX_ROW_SPANS];
+    for (int y = 0; y < _stripH; y++) {
+      const uint16_t *row = cur + y * _width;
+      const uint16_t *old = _prev + y * _width;
+      int spans = 0;
+      if (_fullPush) {
+        spanX[0] = 0;
+        spanW[0] = _width;
+        spans = 1;
+      } else if (memcmp(row, old, _width * 2) != 0) {
+        spans = findSpans(row, old, spanX, spanW);
+      }
+
+      if (spans == 1 && _win.h > 0 && _win.x == spanX[0] &&
+          _win.w == spanW[0] && _win.y + _win.h == y) {
+        _win.h++; // Same span as the row above
+        continue;
+      }
+      flushWindow(cur);
+      for (int i = 0; i < spans; i++) {
+        _win = {spanX[i], y, spanW[i], 1};
+        if (i < spans - 1)
+          flushWindow(cur); // Only the last span may grow downwards
+      }
+    }
+    flushWindow(cur);
+
+    _tft->endWrite();
+    _tft->setSwapBytes(swap);
+    _fullPush = false;
+    _frame.waitUs += micros() - start;
+    PROFILE_RECORD(PROF_PUSH, micros() - start);
+  }
+
+  // Changed spans of one row, merging across short unchanged gaps. Extra
+  // spans beyond MAX_ROW_SPANS are folded into the last one.
+  int findSpans(const uint16_t *row, const uint16_t *old, int *spanX,
+                int *spanW) {
+    int spans = 0;
+    int x = 0;
+    while (x < _width) {
+      if (row[x] == old[x]) {
+        x++;
+        continue;
+      }
+      int first = x;
+      int last = x;
+      while (x < _width && x - last <= SPAN_MERGE_GAP) {
+        if (row[x] != old[x])
+          last = x;
+        x++;
+      }
+      if (spans == MAX_ROW_SPANS) {
+        spanW[spans - 1] = last + 1 - spanX[spans - 1];
+        continue;
+      }
+      spanX[spans] = first;
+      spanW[spans] = last + 1 - first;
+      spans++;
+    }
+    return spans;
+  }
+
+  void flushWindow(const uint16_t *cur) {
+    if (_win.h == 0)
+      return;
+    _tft->setAddrWindow(_win.x, _win.y, _win.w, _win.h);
+    for (int y = _win.y; y < _win.y + _win.h; y++) {
+      const uint16_t *src = cur + y * _width + _win.x;
+      _tft->pushPixels(src, _win.w);
+      memcpy(_prev + y * _width + _win.x, src, _win.w * 2);
+    }
+    _frame.strips++;
+    _frame.bytes += _win.w * _win.h * 2;
+    _win.h = 0;
+  }
+
+  void createBuffers(int rows, bool allowPsram) {
+    _count = 0;
+    _stripH = rows;
+    for (int i = 0; i < (allowPsram ? 1 : 2); i++) {
+      TFT_eSprite *strip = new TFT_eSprite(_tft);
+      strip->setColorDepth(16);
+      strip->setAttribute(PSRAM_ENABLE, allowPsram); // DMA can't read PSRAM
+      if (!strip->createSprite(_width, rows)) {
+        delete strip;
+        break;
+      }
+      _buffers[_count++] = strip;
+    }
+  }
+
+  void endRender() {
+    if (_rendering) {
+      uint32_t us = micros() - _mark;
+      _frame.renderUs += us;
+      PROFILE_RECORD(PROF_DRAW, us);
+      _rendering = false;
+    }
+  }
+};
+
+#endif
@@ -1,29 +1,55 @@
 #include "GameEngine.h"
 
-GameEngine::GameEngine(TFT_eSPI *tft, Input *input) : _tft(tft), _input(input) {
+SaveStore<PenaltySave, 1> save;
+
+GameEngine::GameEngine(TFT_eSPI *tft, Input *input)
+    : _tft(tft), _input(input), _pipeline(tft) {
   _scanlineBuffer = nullptr;
+  _background = nullptr;
+  _fullRedraw = true;
   _state = STATE_MENU;
   _highScore = 0;
+  _newHighScore = false;
 }
 
 void GameEngine::init() {
+  initRender();
+  initSimulation();
+  Serial.println("GameEngine initialized");
+}
+
+void GameEngine::initSimulation() {
+  if (!save.begin("penalty")) {
+    // First version kept the high score under its own key
+    PenaltySave data = {save.prefs().getInt("highScore", 0)};
+    save.set(data);
+    save.flush();
+    if (!save.dirty())
+      save.prefs().remove("highScore");
+  }
+  _highScore = save.get().highScore;
+  resetGame();
+}
+
+void GameEngine::initRender() {
   Serial.println("GameEngine::init() - Scanline rendering mode");
 
-  _scanlineBuffer = new TFT_eSprite(_tft);
-  if (_scanlineBuffer) {
-    bool created = _scanlineBuffer->createSprite(480, SCANLINE_HEIGHT);
-    if (created) {
-      Serial.printf("Scanline buffer created: 480x%d\n", SCANLINE_HEIGHT);
-      _scanlineBuffer->setSwapBytes(true);
-    } else {
-      Serial.println("ERROR: Failed to create scanline buffer!");
-      delete _scanlineBuffer;
-      _scanlineBuffer = nullptr;
-    }
+  if (_pipeline.begin(480, SCANLINE_HEIGHT, 320, RENDER_STRIPS)) {
+    Serial.printf("Scanline buffer created: 480x%d\n",
+                  _pipeline.stripHeight());
+    for (int i = 0; i < _pipeline.bufferCount(); i++)
+      _pipeline.buffer(i)->setSwapBytes(true);
+    _scanlineBuffer = _pipeline.buffer(0);
+  } else {
+    Serial.println("ERROR: Failed to create scanline buffer!");
   }
 
-  resetGame();
-  Serial.println("GameEngine initialized");
+  bakeBackground();
+
+  _hudScore.begin(_tft, 100, 16, 2, C_WHITE, C_GRASS);
+  _hudShot.begin(_tft, 100, 16, 2, C_WHITE, C_GRASS);
+  _hudGoals.begin(_tft, 100, 16, 2, C_WHITE, C_GRASS);
+  _hudInstructions.begin(_tft, 480, 22, 2, C_YELLOW, C_BLACK, MC_DATUM);
 }
 
 void GameEngine::resetGame() {
@@ -38,6 +64,7 @@ void GameEngine::resetShot() {
   _ball.pos.x = KICK_SPOT_X;
   _ball.pos.y = KICK_SPOT_Y;
   _ball.startPos = _ball.pos;
+  _ball.prevPos = _ball.pos;
   _ball.moving = false;
   _ball.scale = 1.0f;
 
@@ -46,6 +73,7 @@ void GameEngine::resetShot() {
 
   _keeperPos.x = GOAL_X;
   _keeperPos.y = GOAL_Y + GOAL_HEIGHT - 12;
+  _keeperPrevPos = _keeperPos;
   _keeperState = KEEPER_IDLE;
 
   _powerLevel = 0.0f;
@@ -58,14 +86,22 @@ void GameEngine::resetShot() {
 }
 
 void GameEngine::update(float dt) {
+  PROFILE_SCOPE(PROF_UPDATE);
+  // Start of the tick, what draw() interpolates from
+  _ball.prevPos = _ball.pos;
+  _keeperPrevPos = _keeperPos;
+
+  _input->poll();
   handleInput();
 
   switch (_state) {
   case STATE_AIMING: {
     JoystickInput joy = _input->getJoystick();
     if (joy.active) {
-      _aimCursor.x += (joy.x / 400.0f) * 6.0f;
-      _aimCursor.y += (joy.y / 400.0f) * 6.0f;
+      // About 30 px per frame at the old ~20 fps full-screen redraw
+      float speed = 600.0f; // px/s at full tilt
+      _aimCursor.x += (joy.x / 2048.0f) * speed * dt;
+      _aimCursor.y += (joy.y / 2048.0f) * speed * dt;
 
       _aimCursor.x = constrain(_aimCursor.x, GOAL_X - GOAL_WIDTH / 2 + 12,
                                GOAL_X + GOAL_WIDTH / 2 - 12);
@@ -99,6 +135,12 @@ void GameEngine::update(float dt) {
       _shotsTaken++;
       if (_shotsTaken >= 5) {
         _state = STATE_GAMEOVER;
+        _newHighScore = _score > _highScore;
+        if (_newHighScore) {
+          _highScore = _score;
+          save.set({_highScore});
+          save.flush(); // The round is over, nothing is moving
+        }
       } else {
         resetShot();
       }
@@ -246,55 +288,213 @@ void GameEngine::checkCollision() {
   }
 }
 
-void GameEngine::draw() {
+void GameEngine::draw(float alpha) {
+  PROFILE_SCOPE(PROF_FRAME);
   if (!_scanlineBuffer) {
     _tft->fillScreen(C_GRASS);
     return;
   }
 
+  // Menu and game over stand still; unless their key changed, skip the
+  // frame before the display list and strip signatures are even built
+  if ((_state == STATE_MENU || _state == STATE_GAMEOVER) &&
+      _pipeline.unchanged(viewKey()))
+    return;
+
+  buildDisplayList(alpha);
+  _hudScore.setValue("Score:%d", _score);
+  _hudShot.setValue("Shot:%d/5", _shotsTaken + 1);
+  _hudGoals.setValue("Goals:%d", _goalsScored);
+
+  int stripH = _pipeline.stripHeight();
+  _pipeline.beginFrame();
+  for (int y = 0; y < 320; y += stripH) {
+    uint32_t sig = stripSignature(y);
+    if (!_fullRedraw && sig == _stripSig[y / stripH])
+      continue; // Nothing in this strip changed since it was pushed
+    _stripSig[y / stripH] = sig;
+    renderScanline(y);
+  }
+  _pipeline.endFrame();
+  _fullRedraw = false;
+}
+
+// Renders the pitch and goal once into the background layer, band by band
+// through the same draw code the strips used
+void GameEngine::bakeBackground() {
+  _background = new TFT_eSprite(_tft);
+  _background->setColorDepth(16);
+  _background->setAttribute(PSRAM_ENABLE, true);
+  if (!_background->createSprite(480, 320)) {
+    Serial.println("Background layer unavailable, drawing pitch per strip");
+    delete _background;
+    _background = nullptr;
+    return;
+  }
+
+  TFT_eSprite *strip = _scanlineBuffer;
+  _scanlineBuffer = _background;
   for (int y = 0; y < 320; y += SCANLINE_HEIGHT) {
-    int height = SCANLINE_HEIGHT;
-    if (y + height > 320) {
-      height = 320 - y;
-    }
+    _background->setViewport(0, y, 480, SCANLINE_HEIGHT);
+    _background->fillSprite(C_GRASS);
+    drawBackground(y);
+    drawGoal(y);
+  }
+  _background->resetViewport();
+  _scanlineBuffer = strip;
+}
 
-    renderScanline(y, height);
+// Seeds the current band with the matching background rows
+void GameEngine::copyBackground(int offsetY) {
+  if (!_background) {
+    _scanlineBuffer->fillSprite(C_GRASS);
+    drawBackground(offsetY);
+    drawGoal(offsetY);
+    return;
   }
+  uint16_t *dst = (uint16_t *)_scanlineBuffer->getPointer() +
+                  _scanlineBuffer->getViewportY() * 480;
+  const uint16_t *src = (uint16_t *)_background->getPointer() + offsetY * 480;
+  memcpy(dst, src, 480 * SCANLINE_HEIGHT * sizeof(uint16_t));
 }
 
-void GameEngine::renderScanline(int y, int height) {
-  _scanlineBuffer->fillSprite(C_GRASS);
-  drawToBuffer(y);
-  _scanlineBuffer->pushSprite(0, y, 0, 0, 480, height);
+// What the menu and game over screens are drawn from
+ViewKey GameEngine::viewKey() const {
+  ViewKey key;
+  key.mix(_state).mix(_score).mix(_shotsTaken).mix(_goalsScored);
+  key.mix(_newHighScore).mix((int)_keeperPos.x).mix(_keeperState);
+  return key;
 }
 
-void GameEngine::drawToBuffer(int offsetY) {
-  drawBackground(offsetY);
-  drawGoal(offsetY);
+// FNV-1a over the text overlay state and every display item in the strip
+uint32_t GameEngine::stripSignature(int y) {
+  uint32_t h = 2166136261u;
+  auto mix = [&h](uint32_t v) {
+    for (int i = 0; i < 4; i++) {
+      h = (h ^ (v & 0xFF)) * 16777619u;
+      v >>= 8;
+    }
+  };
+  mix(_state);
+  mix(_score);
+  mix(_shotsTaken);
+  mix(_goalsScored);
+  mix(_keeperState);
+  for (int row = 0; row < _pipeline.stripHeight(); row += SCANLINE_HEIGHT) {
+    _displayList.forEach(y + row, SCANLINE_HEIGHT,
+                         [&](const DisplayItem &item) {
+                           mix(item.kind);
+                           mix((uint16_t)item.x | ((uint32_t)item.y << 16));
+                           mix((uint16_t)item.top |
+                               ((uint32_t)item.bottom << 16));
+                           mix(item.color);
+                         });
+  }
+  if (y + _pipeline.stripHeight() >= 320)
+    mix(Profiler::overlayStamp()); // Drawn over the last strip
+  return h;
+}
+
+void GameEngine::renderScanline(int y) {
+  _scanlineBuffer = _pipeline.beginStrip();
+  for (int row = 0; row < _pipeline.stripHeight(); row += SCANLINE_HEIGHT) {
+    _pipeline.selectBand(row);
+    copyBackground(y + row);
+    drawToBuffer(y + row);
+  }
+  _pipeline.pushStrip(y);
+}
+
+// Resolves the players, ball, cursor and power bar into screen rects
+// once per frame, in draw order. The ball and keeper are interpolated
+// between their last two ticks by alpha.
+void GameEngine::buildDisplayList(float alpha) {
+  _displayList.begin(SCANLINE_HEIGHT, 320);
+  DisplayItem *item;
 
   if (_state != STATE_SHOOTING && _state != STATE_GOAL &&
       _state != STATE_MISS) {
-    drawPlayer(offsetY);
+    int py = KICK_SPOT_Y;
+    item = _displayList.add(DL_PLAYER, py - 62, py); // Head above the body
+    if (item) {
+      item->x = KICK_SPOT_X - 55;
+      item->y = py;
+    }
   }
 
-  drawKeeper(offsetY);
+  int ky = _keeperPos.y;
+  item = _displayList.add(DL_KEEPER, ky - 53, ky);
+  if (item) {
+    item->x = _keeperPrevPos.x + (_keeperPos.x - _keeperPrevPos.x) * alpha;
+    item->y = ky;
+  }
 
   // Only draw ball during shooting
   if (_state == STATE_SHOOTING) {
-    drawBall(offsetY);
+    int r = 12 * _ball.scale;
+    int by = _ball.prevPos.y + (_ball.pos.y - _ball.prevPos.y) * alpha;
+    item = _displayList.add(DL_BALL, by - r, by + r + 4); // Shadow +3px
+    if (item) {
+      item->x = _ball.prevPos.x + (_ball.pos.x - _ball.prevPos.x) * alpha;
+      item->y = by;
+      item->data = &_ball;
+    }
   }
 
-  if (_state == STATE_AIMING) {
-    drawCursor(offsetY);
-    drawInstructions("Joystick: Aim | A: Lock", offsetY);
+  if (_state == STATE_AIMING || _state == STATE_POWER) {
+    const int s = 18;
+    int y = _aimCursor.y;
+    item = _displayList.add(DL_CURSOR, y - s, y + s + 1);
+    if (item) {
+      item->x = _aimCursor.x;
+      item->y = y;
+    }
   }
 
   if (_state == STATE_POWER) {
-    drawCursor(offsetY);
-    drawPowerBar(offsetY);
-    drawInstructions("A: SHOOT! | B: Cancel", offsetY);
+    // Bar plus its 3px frame and the "POWER" label below
+    item = _displayList.add(DL_POWERBAR, 127, 130 + 35 + 24);
+    if (item) {
+      item->x = (280 - 6) * _powerLevel; // Filled width
+      item->color = C_GREEN;
+      if (_powerLevel > 0.75f)
+        item->color = C_RED;
+      else if (_powerLevel > 0.5f)
+        item->color = C_ORANGE;
+      else if (_powerLevel > 0.25f)
+        item->color = C_YELLOW;
+    }
   }
 
+  _displayList.finish();
+}
+
+void GameEngine::drawToBuffer(int offsetY) {
+  _displayList.forEach(offsetY, SCANLINE_HEIGHT, [&](const DisplayItem &item) {
+    switch (item.kind) {
+    case DL_PLAYER:
+      drawPlayer(item, offsetY);
+      break;
+    case DL_KEEPER:
+      drawKeeper(item, offsetY);
+      break;
+    case DL_BALL:
+      drawBall(item, offsetY);
+      break;
+    case DL_CURSOR:
+      drawCursor(item, offsetY);
+      break;
+    case DL_POWERBAR:
+      drawPowerBar(item, offsetY);
+      break;
+    }
+  });
+
+  if (_state == STATE_AIMING)
+    drawInstructions("Joystick: Aim | A: Lock", offsetY);
+  if (_state == STATE_POWER)
+    drawInstructions("A: SHOOT! | B: Cancel", offsetY);
+
   drawHUD(offsetY);
 
   if (_state == STATE_MENU)
@@ -348,7 +548,8 @@ void GameEngine::drawGoal(int offsetY) {
   int top = GOAL_Y;
   int bottom = GOAL_Y + GOAL_HEIGHT;
 
-  if (bottom < offsetY || top >= offsetY + SCANLINE_HEIGHT)
+  // Crossbar starts 6px above the goal, net background ends 15px below
+  if (bottom + 15 < offsetY || top - 6 >= offsetY + SCANLINE_HEIGHT)
     return;
 
   // Dark background for depth
@@ -378,73 +579,60 @@ void GameEngine::drawGoal(int offsetY) {
                             0x2104);
 }
 
-void GameEngine::drawKeeper(int offsetY) {
+void GameEngine::drawKeeper(const DisplayItem &item, int offsetY) {
   int w = 35;
   int h = 35;
-  int ky = _keeperPos.y;
-
-  if (ky < offsetY || ky - h >= offsetY + SCANLINE_HEIGHT)
-    return;
+  int kx = item.x;
+  int ky = item.y;
 
   // Body
-  _scanlineBuffer->fillRect(_keeperPos.x - w / 2, ky - h - offsetY, w, h,
-                            C_RED);
+  _scanlineBuffer->fillRect(kx - w / 2, ky - h - offsetY, w, h, C_RED);
 
   // Head
-  _scanlineBuffer->fillCircle(_keeperPos.x, ky - h - 8 - offsetY, 10, C_ORANGE);
+  _scanlineBuffer->fillCircle(kx, ky - h - 8 - offsetY, 10, C_ORANGE);
 
   // Arms
   if (_keeperState == KEEPER_DIVE_LEFT) {
-    _scanlineBuffer->fillRect(_keeperPos.x - w / 2 - 18, ky - h / 2 - offsetY,
-                              18, 8, C_RED);
-  } else if (_keeperState == KEEPER_DIVE_RIGHT) {
-    _scanlineBuffer->fillRect(_keeperPos.x + w / 2, ky - h / 2 - offsetY, 18, 8,
+    _scanlineBuffer->fillRect(kx - w / 2 - 18, ky - h / 2 - offsetY, 18, 8,
                               C_RED);
+  } else if (_keeperState == KEEPER_DIVE_RIGHT) {
+    _scanlineBuffer->fillRect(kx + w / 2, ky - h / 2 - offsetY, 18, 8, C_RED);
   }
 }
 
-void GameEngine::drawPlayer(int offsetY) {
-  int px = KICK_SPOT_X - 55;
-  int py = KICK_SPOT_Y;
-
-  if (py < offsetY || py - 50 >= offsetY + SCANLINE_HEIGHT)
-    return;
+void GameEngine::drawPlayer(const DisplayItem &item, int offsetY) {
+  int px = item.x;
+  int py = item.y;
 
   _scanlineBuffer->fillRect(px, py - 38 - offsetY, 38, 38, C_BLUE);
   _scanlineBuffer->fillCircle(px + 19, py - 50 - offsetY, 12, C_ORANGE);
   _scanlineBuffer->fillRect(px + 38, py - 22 - offsetY, 17, 10, C_BLUE);
 }
 
-void GameEngine::drawBall(int offsetY) {
-  int r = 12 * _ball.scale;
-  int by = _ball.pos.y;
-
-  if (by < offsetY - r || by >= offsetY + SCANLINE_HEIGHT + r)
-    return;
+void GameEngine::drawBall(const DisplayItem &item, int offsetY) {
+  const Ball &ball = *(const Ball *)item.data;
+  int r = 12 * ball.scale;
+  int bx = item.x;
+  int by = item.y;
 
-  _scanlineBuffer->fillCircle(_ball.pos.x + 3, by + 3 - offsetY, r,
-                              C_DARKGREEN);
-  _scanlineBuffer->fillCircle(_ball.pos.x, by - offsetY, r, C_WHITE);
-  _scanlineBuffer->drawCircle(_ball.pos.x, by - offsetY, r, C_BLACK);
+  _scanlineBuffer->fillCircle(bx + 3, by + 3 - offsetY, r, C_DARKGREEN);
+  _scanlineBuffer->fillCircle(bx, by - offsetY, r, C_WHITE);
+  _scanlineBuffer->drawCircle(bx, by - offsetY, r, C_BLACK);
 
   if (r > 6) {
-    _scanlineBuffer->fillCircle(_ball.pos.x - r / 3, by - r / 3 - offsetY,
-                                r / 5, C_BLACK);
-    _scanlineBuffer->fillCircle(_ball.pos.x + r / 3, by - r / 3 - offsetY,
-                                r / 5, C_BLACK);
-    _scanlineBuffer->fillCircle(_ball.pos.x, by + r / 3 - offsetY, r / 5,
+    _scanlineBuffer->fillCircle(bx - r / 3, by - r / 3 - offsetY, r / 5,
                                 C_BLACK);
+    _scanlineBuffer->fillCircle(bx + r / 3, by - r / 3 - offsetY, r / 5,
+                                C_BLACK);
+    _scanlineBuffer->fillCircle(bx, by + r / 3 - offsetY, r / 5, C_BLACK);
   }
 }
 
-void GameEngine::drawCursor(int offsetY) {
-  int x = _aimCursor.x;
-  int y = _aimCursor.y;
+void GameEngine::drawCursor(const DisplayItem &item, int offsetY) {
+  int x = item.x;
+  int y = item.y;
   int s = 18;
 
-  if (y < offsetY - s || y >= offsetY + SCANLINE_HEIGHT + s)
-    return;
-
   _scanlineBuffer->drawLine(x - s, y - offsetY, x + s, y - offsetY, C_YELLOW);
   _scanlineBuffer->drawLine(x, y - s - offsetY, x, y + s - offsetY, C_YELLOW);
   _scanlineBuffer->drawCircle(x, y - offsetY, s, C_YELLOW);
@@ -452,28 +640,17 @@ void GameEngine::drawCursor(int offsetY) {
   _scanlineBuffer->fillCircle(x, y - offsetY, 2, C_RED);
 }
 
-void GameEngine::drawPowerBar(int offsetY) {
+void GameEngine::drawPowerBar(const DisplayItem &item, int offsetY) {
   int w = 280;
   int h = 35;
   int x = (480 - w) / 2;
   int y = 130;
-
-  if (y + h < offsetY || y >= offsetY + SCANLINE_HEIGHT)
-    return;
-
-  uint16_t barColor = C_GREEN;
-  if (_powerLevel > 0.75f)
-    barColor = C_RED;
-  else if (_powerLevel > 0.5f)
-    barColor = C_ORANGE;
-  else if (_powerLevel > 0.25f)
-    barColor = C_YELLOW;
+  uint16_t barColor = item.color;
 
   _scanlineBuffer->fillRect(x - 3, y - 3 - offsetY, w + 6, h + 6, C_BLACK);
   _scanlineBuffer->drawRect(x, y - offsetY, w, h, C_WHITE);
   _scanlineBuffer->drawRect(x + 1, y + 1 - offsetY, w - 2, h - 2, C_WHITE);
-  _scanlineBuffer->fillRect(x + 3, y + 3 - offsetY, (w - 6) * _powerLevel,
-                            h - 6, barColor);
+  _scanlineBuffer->fillRect(x + 3, y + 3 - offsetY, item.x, h - 6, barColor);
 
   _scanlineBuffer->setTextColor(C_WHITE, C_BLACK);
   _scanlineBuffer->drawCentreString("POWER", 240, y + h + 8 - offsetY, 2);
@@ -485,19 +662,10 @@ void GameEngine::drawHUD(int offsetY) {
   if (hudY < offsetY || hudY >= offsetY + SCANLINE_HEIGHT)
     return;
 
-  char buf[32];
-
-  _scanlineBuffer->setTextColor(C_WHITE, C_GRASS);
-  _scanlineBuffer->setTextSize(1);
-
-  sprintf(buf, "Score:%d", _score);
-  _scanlineBuffer->drawString(buf, 10, hudY - offsetY, 2);
-
-  sprintf(buf, "Shot:%d/5", _shotsTaken + 1);
-  _scanlineBuffer->drawString(buf, 190, hudY - offsetY, 2);
-
-  sprintf(buf, "Goals:%d", _goalsScored);
-  _scanlineBuffer->drawString(buf, 370, hudY - offsetY, 2);
+  // Pre-rendered in draw() when the values change
+  _hudScore.draw(_scanlineBuffer, 10, hudY - offsetY);
+  _hudShot.draw(_scanlineBuffer, 190, hudY - offsetY);
+  _hudGoals.draw(_scanlineBuffer, 370, hudY - offsetY);
 }
 
 void GameEngine::drawMenu(int offsetY) {
@@ -562,8 +730,7 @@ void GameEngine::drawGameOver(int offsetY) {
   sprintf(buf, "Goals: %d / 5", _goalsScored);
   _scanlineBuffer->drawCentreString(buf, 240, goY + 100 - offsetY, 2);
 
-  if (_score > _highScore) {
-    _highScore = _score;
+  if (_newHighScore) {
     _scanlineBuffer->setTextColor(C_GREEN, C_BLACK);
     _scanlineBuffer->drawCentreString("NEW HIGH SCORE!", 240,
                                       goY + 125 - offsetY, 2);
@@ -580,7 +747,7 @@ void GameEngine::drawInstructions(const char *text, int offsetY) {
   if (instY < offsetY || instY + 20 >= offsetY + SCANLINE_HEIGHT)
     return;
 
-  _scanlineBuffer->fillRect(0, instY - offsetY, 480, 22, C_BLACK);
-  _scanlineBuffer->setTextColor(C_YELLOW, C_BLACK);
-  _scanlineBuffer->drawCentreString(text, 240, instY + 3 - offsetY, 2);
+  // Black bar with the text centered; only re-rendered when text changes
+  _hudInstructions.setText(text);
+  _hudInstructions.draw(_scanlineBuffer, 0, instY - offsetY);
 }
@@ -2,7 +2,11 @@
 #define GAME_ENGINE_H
 
 #include "Assets.h"
+#include "DisplayList.h"
+#include "Hud.h"
 #include "Input.h"
+#include "RenderPipeline.h"
+#include "SaveStore.h"
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 
@@ -24,6 +28,7 @@ struct Vector2 {
 
 struct Ball {
   Vector2 pos;
+  Vector2 prevPos; // Position at the previous tick, for interpolation
   Vector2 startPos;
   Vector2 targetPos;
   float speed;
@@ -31,29 +36,26 @@ struct Ball {
   bool moving;
 };
 
-class GameEngine {
-public:
-  GameEngine(TFT_eSPI *tft, Input *input);
-  void init();
-  void update(float dt);
-  void draw();
-
-private:
-  TFT_eSPI *_tft;
-  Input *_input;
-  TFT_eSprite *_scanlineBuffer;
-
-  static const int SCANLINE_HEIGHT = 40;
+// Everything kept across power cycles, stored as one record (SaveStore)
+struct PenaltySave {
+  int32_t highScore;
+};
 
+// Everything draw() reads. The engine keeps it as a base so game code uses
+// the fields directly; in dual-core mode the simulation copies it into a
+// snapshot after its ticks and the render-side engine draws from a copy.
+struct RenderState {
   GameState _state;
   int _score;
   int _shotsTaken;
   int _goalsScored;
   int _highScore;
+  bool _newHighScore; // Set on entering STATE_GAMEOVER
 
   Ball _ball;
 
   Vector2 _keeperPos;
+  Vector2 _keeperPrevPos;
   KeeperState _keeperState;
 
   Vector2 _aimCursor;
@@ -61,6 +63,63 @@ private:
   float _powerLevel;
   float _powerDir;
   bool _powerLocked;
+};
+
+class GameEngine : private RenderState {
+public:
+  // Simulation tick and render target for LoopDriver
+  static const int TICK_HZ = 120;
+  static const int RENDER_HZ = 60;
+
+  GameEngine(TFT_eSPI *tft, Input *input);
+  void init(); // initSimulation() + initRender()
+  void initSimulation();
+  void initRender();
+  void update(float dt);
+  void draw(float alpha); // alpha: fraction of a tick since the last update
+  const PipelineStats &getPipelineStats() const { return _pipeline.stats(); }
+  uint32_t getPushedBytes() const { return _pipeline.stats().bytes; }
+
+  // Dual-core mode: copy the state out after ticking / into the render-side
+  // engine before drawing
+  void snapshot(RenderState &out) const { out = *this; }
+  void applySnapshot(const RenderState &state) {
+    RenderState::operator=(state);
+  }
+
+private:
+  TFT_eSPI *_tft;
+  Input *_input;
+  RenderPipeline _pipeline;
+  TFT_eSprite *_scanlineBuffer; // Strip buffer currently being drawn
+
+  static const int SCANLINE_HEIGHT = 40;
+
+  // Field elements resolved once per frame, binned by band
+  enum DisplayKind : uint8_t {
+    DL_PLAYER,
+    DL_KEEPER,
+    DL_BALL,
+    DL_CURSOR,
+    DL_POWERBAR
+  };
+  DisplayList<8, 8> _displayList;
+
+  // HUD line and instruction bar, rasterized only when their text changes
+  HudField _hudScore;
+  HudField _hudShot;
+  HudField _hudGoals;
+  HudField _hudInstructions;
+
+  // Static pitch and goal rendered once at init (PSRAM); null if it couldn't
+  // be allocated, then they're drawn per band
+  TFT_eSprite *_background;
+
+  // Strip damage: a signature of everything drawn in each strip. Strips
+  // whose signature didn't change since they were last pushed are skipped.
+  static const int MAX_STRIPS = 320 / SCANLINE_HEIGHT;
+  uint32_t _stripSig[MAX_STRIPS];
+  bool _fullRedraw;
 
   const int GOAL_X = 240;
   const int GOAL_Y = 30;
@@ -77,16 +136,21 @@ private:
   void updateKeeper(float dt);
   void checkCollision();
 
-  void renderScanline(int y, int height);
+  void bakeBackground();
+  void copyBackground(int offsetY);
+  ViewKey viewKey() const;
+  uint32_t stripSignature(int y);
+  void renderScanline(int y);
   void drawToBuffer(int offsetY);
 
   void drawBackground(int offsetY);
+  void buildDisplayList(float alpha);
   void drawGoal(int offsetY);
-  void drawKeeper(int offsetY);
-  void drawPlayer(int offsetY);
-  void drawBall(int offsetY);
-  void drawCursor(int offsetY);
-  void drawPowerBar(int offsetY);
+  void drawKeeper(const DisplayItem &item, int offsetY);
+  void drawPlayer(const DisplayItem &item, int offsetY);
+  void drawBall(const DisplayItem &item, int offsetY);
+  void drawCursor(const DisplayItem &item, int offsetY);
+  void drawPowerBar(const DisplayItem &item, int offsetY);
   void drawHUD(int offsetY);
   void drawMenu(int offsetY);
   void drawResultMsg(const char *msg, uint16_t color, int offsetY);
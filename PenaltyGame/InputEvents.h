@@ -0,0 +1,140 @@
+#ifndef INPUT_EVENTS_H
+#define INPUT_EVENTS_H
+
+#include <atomic>
+#include <stdint.h>
+
+// Joystick direction, same order as PacMan's Direction
+enum InputDirection {
+  INPUT_DIR_UP,
+  INPUT_DIR_DOWN,
+  INPUT_DIR_LEFT,
+  INPUT_DIR_RIGHT,
+  INPUT_DIR_NONE
+};
+
+enum InputEventType : uint8_t {
+  INPUT_PRESS,
+  INPUT_RELEASE,
+  INPUT_NAV,   // Joystick pushed into a direction
+  INPUT_REPEAT // Joystick still held in that direction
+};
+
+enum InputSource : uint8_t { INPUT_BUTTON_A, INPUT_BUTTON_B, INPUT_JOYSTICK };
+
+struct InputEvent {
+  uint32_t time;  // micros() when the input changed (debounce not included)
+  uint8_t type;   // InputEventType
+  uint8_t source; // InputSource
+  uint8_t dir;    // InputDirection, for joystick events
+};
+
+// Dominant direction of a centered joystick reading, or NONE inside the
+// deadzone
+inline InputDirection joystickDirection(int x, int y, int deadzone) {
+  int ax = x < 0 ? -x : x;
+  int ay = y < 0 ? -y : y;
+  if (ax < deadzone && ay < deadzone)
+    return INPUT_DIR_NONE;
+  if (ax > ay)
+    return x > 0 ? INPUT_DIR_RIGHT : INPUT_DIR_LEFT;
+  return y > 0 ? INPUT_DIR_DOWN : INPUT_DIR_UP;
+}
+
+// Turns raw samples of the buttons and joystick direction into debounced
+// events. sample() runs at a fixed rate on one task and pop() drains the
+// events on another; the ring between them is lock-free (one writer, one
+// reader) and drops new events when full.
+//
+// Only <atomic> / <stdint.h>, so it also builds on a host.
+class InputSampler {
+public:
+  static const uint32_t DEBOUNCE_US = 5000;   // Button level held this long
+  static const uint32_t NAV_SETTLE_US = 10000; // Same for a direction
+  static const uint32_t REPEAT_DELAY_US = 300000;
+  static const uint32_t REPEAT_PERIOD_US = 200000;
+  static const int RING_SIZE = 32; // Power of two
+
+  InputSampler()
+      : _nav(INPUT_DIR_NONE), _navRaw(INPUT_DIR_NONE), _navSince(0),
+        _nextRepeat(0), _head(0), _tail(0), _dropped(0) {
+    for (int i = 0; i < 2; i++)
+      _buttons[i] = {false, false, 0};
+  }
+
+  void sample(bool a, bool b, InputDirection dir, uint32_t now) {
+    debounce(_buttons[0], a, INPUT_BUTTON_A, now);
+    debounce(_buttons[1], b, INPUT_BUTTON_B, now);
+
+    if (dir != _navRaw) {
+      _navRaw = dir;
+      _navSince = now;
+    }
+    if (_navRaw != _nav && now - _navSince >= NAV_SETTLE_US) {
+      _nav = _navRaw;
+      if (_nav != INPUT_DIR_NONE) {
+        push(INPUT_NAV, INPUT_JOYSTICK, _nav, _navSince);
+        _nextRepeat = _navSince + REPEAT_DELAY_US;
+      }
+    } else if (_nav != INPUT_DIR_NONE && (int32_t)(now - _nextRepeat) >= 0) {
+      push(INPUT_REPEAT, INPUT_JOYSTICK, _nav, now);
+      _nextRepeat += REPEAT_PERIOD_US;
+    }
+  }
+
+  bool pop(InputEvent &event) {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire))
+      return false;
+    event = _ring[tail % RING_SIZE];
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Events lost to a full ring (nobody draining)
+  uint32_t dropped() const { return _dropped; }
+
+private:
+  struct Debounce {
+    bool level;     // Debounced
+    bool raw;       // Last sample
+    uint32_t since; // When raw last changed
+  };
+
+  Debounce _buttons[2];
+  InputDirection _nav;
+  InputDirection _navRaw;
+  uint32_t _navSince;
+  uint32_t _nextRepeat;
+
+  InputEvent _ring[RING_SIZE];
+  std::atomic<uint32_t> _head; // Written by sample()
+  std::atomic<uint32_t> _tail; // Written by pop()
+  uint32_t _dropped;
+
+  void debounce(Debounce &d, bool raw, InputSource source, uint32_t now) {
+    if (raw != d.raw) {
+      d.raw = raw;
+      d.since = now;
+    }
+    if (d.raw != d.level && now - d.since >= DEBOUNCE_US) {
+      d.level = d.raw;
+      push(d.level ? INPUT_PRESS : INPUT_RELEASE, source, INPUT_DIR_NONE,
+           d.since);
+    }
+  }
+
+  void push(InputEventType type, InputSource source, InputDirection dir,
+            uint32_t time) {
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) == RING_SIZE) {
+      _dropped++;
+      return;
+    }
+    _ring[head % RING_SIZE] = {time, (uint8_t)type, (uint8_t)source,
+                               (uint8_t)dir};
+    _head.store(head + 1, std::memory_order_release);
+  }
+};
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef LOOP_DRIVER_H
+#define LOOP_DRIVER_H
+
+#include "Profiler.h"
+#include <Arduino.h>
+
+// Loop timing since the last reset
+struct LoopStats {
+  uint32_t ticks;          // update() calls
+  uint32_t renders;        // draw() calls
+  uint32_t droppedRenders; // Render slots skipped because the loop was late
+  uint32_t droppedTicks;   // Ticks discarded by the catch-up limit
+  uint32_t jitterMaxUs;    // Worst render interval error
+  uint64_t jitterSumUs;    // Sum of render interval errors
+  uint32_t maxTicksPerLoop;
+};
+
+// Fixed-timestep driver: update() runs at tickHz from an accumulator, draw()
+// at renderHz with the fraction of a tick left in the accumulator (alpha),
+// so rendering can interpolate between the last two ticks.
+//
+// Ticks are never skipped to keep up with rendering; when drawing falls
+// behind (SPI-bound), render slots are dropped instead. Only a stall longer
+// than MAX_CATCHUP_US discards ticks. When ahead of both schedules the loop
+// sleeps (delay() yields to other tasks) instead of spinning.
+//
+// With the dual-core split the simulation task calls runTicks() and the
+// render task runRenders(); each side only touches its own timing state.
+// The stats are shared and only meant for diagnostics.
+//
+// Send 's' over serial to print the stats, 'p' for the profiler
+// histograms, 'r' to reset both.
+class LoopDriver {
+public:
+  static const uint32_t MAX_CATCHUP_US = 250000;
+
+  LoopDriver(int tickHz, int renderHz)
+      : _tickUs(1000000 / tickHz), _renderUs(1000000 / renderHz), _last(0),
+        _acc(0), _nextRender(0), _lastRender(0) {
+    resetStats();
+  }
+
+  void begin() {
+    _last = micros();
+    _acc = 0;
+    _nextRender = _last;
+    _lastRender = 0;
+  }
+
+  float tickSeconds() const { return _tickUs / 1000000.0f; }
+  const LoopStats &stats() const { return _stats; }
+
+  void resetStats() { memset(&_stats, 0, sizeof(_stats)); }
+
+  // One pass of the Arduino loop(): due ticks, at most one render, sleep
+  template <typename Update, typename Draw>
+  void run(Update update, Draw draw) {
+    runDueTicks(update);
+    if (renderDue()) {
+      uint32_t accNow = _acc + (micros() - _last);
+      draw(min(1.0f, (float)accNow / _tickUs));
+      _stats.renders++;
+    }
+    pollSerial();
+    Profiler::poll();
+    sleepUntilDue(true, true);
+  }
+
+  // Dual-core mode, simulation task: due ticks, then sleep until the next
+  // one. Returns how many ticks ran.
+  template <typename Update> uint32_t runTicks(Update update) {
+    uint32_t ticks = runDueTicks(update);
+    pollSerial();
+    Profiler::poll();
+    sleepUntilDue(true, false);
+    return ticks;
+  }
+
+  // Dual-core mode, render task: at most one draw() per render slot, then
+  // sleep. draw() gets its alpha from alphaSince().
+  template <typename Draw> void runRenders(Draw draw) {
+    if (renderDue()) {
+      draw();
+      _stats.renders++;
+    }
+    sleepUntilDue(false, true);
+  }
+
+  // Alpha for a snapshot published at tickTime (micros), for renderers that
+  // don't share the tick accumulator
+  float alphaSince(uint32_t tickTime) const {
+    return min(1.0f, (float)(micros() - tickTime) / _tickUs);
+  }
+
+  void printStats() const {
+    Serial.printf("Loop: %lu ticks, %lu renders, dropped %lu renders / %lu "
+                  "ticks\n",
+                  (unsigned long)_stats.ticks, (unsigned long)_stats.renders,
+                  (unsigned long)_stats.droppedRenders,
+                  (unsigned long)_stats.droppedTicks);
+    Serial.printf("Loop: render jitter avg %lu us, max %lu us, max %lu ticks "
+                  "per loop\n",
+                  _stats.renders > 1
+                      ? (unsigned long)(_stats.jitterSumUs /
+                                        (_stats.renders - 1))
+                      : 0UL,
+                  (unsigned long)_stats.jitterMaxUs,
+                  (unsigned long)_stats.maxTicksPerLoop);
+  }
+
+private:
+  uint32_t _tickUs;
+  uint32_t _renderUs;
+  uint32_t _last;
+  uint32_t _acc;
+  uint32_t _nextRender;
+  uint32_t _lastRender;
+  LoopStats _stats;
+
+  template <typename Update> uint32_t runDueTicks(Update update) {
+    uint32_t now = micros();
+    _acc += now - _last;
+    _last = now;
+    if (_acc > MAX_CATCHUP_US) {
+      _stats.droppedTicks += (_acc - MAX_CATCHUP_US) / _tickUs;
+      _acc = MAX_CATCHUP_US;
+    }
+
+    uint32_t ticks = 0;
+    float dt = tickSeconds();
+    while (_acc >= _tickUs) {
+      update(dt);
+      _acc -= _tickUs;
+      ticks++;
+    }
+    _stats.ticks += ticks;
+    if (ticks > _stats.maxTicksPerLoop)
+      _stats.maxTicksPerLoop = ticks;
+    return ticks;
+  }
+
+  // Claims the current render slot if it is due, tracking jitter and
+  // dropping whole slots the loop was late for
+  bool renderDue() {
+    uint32_t now = micros();
+    if ((int32_t)(now - _nextRender) < 0)
+      return false;
+    if (_lastRender) {
+      uint32_t interval = now - _lastRender;
+      uint32_t error =
+          interval > _renderUs ? interval - _renderUs : _renderUs - interval;
+      _stats.jitterSumUs += error;
+      if (error > _stats.jitterMaxUs)
+        _stats.jitterMaxUs = error;
+    }
+    _lastRender = now;
+    _nextRender += _renderUs;
+    // Late by whole slots: skip them rather than rendering back-to-back
+    if ((int32_t)(now - _nextRender) >= 0) {
+      uint32_t late = (now - _nextRender) / _renderUs + 1;
+      _stats.droppedRenders += late;
+      _nextRender += late * _renderUs;
+    }
+    return true;
+  }
+
+  // Sleeps until the next tick and/or render is due
+  void sleepUntilDue(bool tick, bool render) {
+    uint32_t now = micros();
+    uint32_t wait = UINT32_MAX;
+    if (tick) {
+      uint32_t acc = _acc + (now - _last);
+      wait = acc < _tickUs ? _tickUs - acc : 0;
+    }
+    if (render) {
+      uint32_t toRender =
+          (int32_t)(_nextRender - now) > 0 ? _nextRender - now : 0;
+      wait = min(wait, toRender);
+    }
+    if (wait >= 1000)
+      delay(wait / 1000);
+  }
+
+  void pollSerial() {
+    while (Serial.available()) {
+      char c = Serial.read();
+      if (c == 's') {
+        printStats();
+      } else if (c == 'p') {
+        Profiler::print();
+      } else if (c == 'r') {
+        resetStats();
+        Profiler::reset();
+      }
+    }
+  }
+};
+
+#endif
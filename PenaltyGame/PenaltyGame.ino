@@ -1,6 +1,8 @@
 #include "GameEngine.h"
 #include "Input.h"
+#include "LoopDriver.h"
 #include "System.h"
+#include "TripleBuffer.h"
 #include <Arduino.h>
 #include <SPI.h>
 #include <TFT_eSPI.h>
@@ -12,7 +14,46 @@ TFT_eSPI tft = TFT_eSPI();
 Input input;
 GameEngine engine(&tft, &input);
 
-unsigned long lastTime = 0;
+LoopDriver loopDriver(GameEngine::TICK_HZ, GameEngine::RENDER_HZ);
+
+// 1: simulation task on core 0 and rendering (SPI) task on core 1, handing
+// over state snapshots; 0: update and draw in turn from loop()
+#define DUAL_CORE 0
+
+#if DUAL_CORE
+// Render-side engine: never ticks, draws the newest published snapshot
+GameEngine view(&tft, &input);
+
+struct Snapshot {
+  RenderState state;
+  uint32_t tickTime; // micros() when published
+};
+TripleBuffer<Snapshot> snapshots;
+
+void publishSnapshot() {
+  Snapshot &snap = snapshots.back();
+  engine.snapshot(snap.state);
+  snap.tickTime = micros();
+  snapshots.publish();
+}
+
+void simTask(void *) {
+  for (;;) {
+    if (loopDriver.runTicks([](float dt) { engine.update(dt); }))
+      publishSnapshot();
+  }
+}
+
+void renderTask(void *) {
+  for (;;) {
+    loopDriver.runRenders([]() {
+      if (snapshots.acquire())
+        view.applySnapshot(snapshots.front().state);
+      view.draw(loopDriver.alphaSince(snapshots.front().tickTime));
+    });
+  }
+}
+#endif
 
 void setup() {
   Serial.begin(115200);
@@ -44,28 +85,35 @@ void setup() {
 
   // Init Game Engine
   Serial.println("Initializing Game Engine...");
+#if DUAL_CORE
+  engine.initSimulation();
+  view.initRender();
+  publishSnapshot();
+#else
   engine.init();
+#endif
   Serial.println("Game Engine OK");
 
-  lastTime = millis();
+  loopDriver.begin();
+#if DUAL_CORE
+  xTaskCreatePinnedToCore(simTask, "sim", 8192, nullptr, 1, nullptr, 0);
+  xTaskCreatePinnedToCore(renderTask, "render", 8192, nullptr, 1, nullptr, 1);
+#endif
   Serial.println("Setup complete!");
   Serial.println("Free heap: " + String(ESP.getFreeHeap()));
 }
 
 void loop() {
-  unsigned long now = millis();
-  float dt = (now - lastTime) / 1000.0f;
-  lastTime = now;
-
-  // Cap dt to avoid huge jumps
-  if (dt > 0.1f)
-    dt = 0.1f;
-
-  engine.update(dt);
-  engine.draw();
+#if DUAL_CORE
+  delay(100); // simTask and renderTask do the work
+#else
+  loopDriver.run([](float dt) { engine.update(dt); },
+                 [](float alpha) { engine.draw(alpha); });
+#endif
 
   // Debug every 2 seconds
   static unsigned long lastDebug = 0;
+  unsigned long now = millis();
   if (now - lastDebug > 2000) {
     Serial.println("Loop running... Free heap: " + String(ESP.getFreeHeap()));
     lastDebug = now;
@@ -0,0 +1,130 @@
+#ifndef SAVE_STORE_H
+#define SAVE_STORE_H
+
+#include "Profiler.h"
+#include <Arduino.h>
+#include <Preferences.h>
+
+// A game's whole save as one POD record T, kept in RAM and stored as a
+// single NVS blob behind a small header (version, size, CRC-32). Loading
+// is one read and saving one write.
+//
+// Write-behind: set() only marks the record dirty when it differs from
+// the last one; flush() writes it. Games flush when play stops (pause,
+// game over, level end, back to the menu) and from flushIfDue() outside of
+// play, so no gameplay frame stalls on a flash erase.
+//
+// Each flush is timed into stats() and the profiler's "save" row, so the
+// count and cost of flash writes show up with 'p' instead of on every save.
+//
+// NVS keeps the old blob until the new one is completely written, so a
+// reset mid-flush leaves the old record or the new one, never a mix. A
+// failed write stays dirty and is retried on the next flush.
+template <typename T, uint16_t VERSION> class SaveStore {
+public:
+  struct Stats {
+    uint32_t flushes;
+    uint32_t failures; // Flushes whose write did not complete
+    uint32_t lastMicros; // Time spent in the last flush
+    uint32_t maxMicros;
+  };
+
+  SaveStore() : _dirty(false), _dirtySince(0), _stats() {
+    memset(&_blob, 0, sizeof(_blob));
+  }
+
+  // Opens the namespace and reads the record. False when there is no
+  // valid record of this VERSION (first boot, or an older save format):
+  // the caller then fills one in, e.g. from the old keys through prefs().
+  // The record is dirty from then on, so the next flush() writes it even
+  // if it equals the zeroed default and the next boot finds it.
+  bool begin(const char *name) {
+    _prefs.begin(name, false);
+    _dirty = !load();
+    if (_dirty) {
+      memset(&_blob, 0, sizeof(_blob));
+      _dirtySince = millis();
+    }
+    return !_dirty;
+  }
+
+  const T &get() const { return _blob.data; }
+  void set(const T &data) {
+    if (memcmp(&data, &_blob.data, sizeof(T)) == 0)
+      return;
+    _blob.data = data;
+    if (!_dirty)
+      _dirtySince = millis();
+    _dirty = true;
+  }
+
+  void flush() {
+    if (!_dirty)
+      return;
+    uint32_t start = micros();
+    _blob.version = VERSION;
+    _blob.size = sizeof(T);
+    _blob.crc = crc32(&_blob.data, sizeof(T));
+    _dirty = _prefs.putBytes("save", &_blob, sizeof(_blob)) != sizeof(_blob);
+    _stats.flushes++;
+    _stats.failures += _dirty;
+    _stats.lastMicros = micros() - start;
+    if (_stats.lastMicros > _stats.maxMicros)
+      _stats.maxMicros = _stats.lastMicros;
+    PROFILE_RECORD(PROF_SAVE, _stats.lastMicros);
+  }
+
+  // Flushes once the oldest unsaved change is delayMs old
+  void flushIfDue(uint32_t delayMs) {
+    if (_dirty && millis() - _dirtySince >= delayMs)
+      flush();
+  }
+
+  bool dirty() const { return _dirty; }
+  const Stats &stats() const { return _stats; }
+
+  // The namespace itself, for migrating keys from older save formats
+  Preferences &prefs() { return _prefs; }
+
+private:
+  struct Blob {
+    uint16_t version;
+    uint16_t size;
+    uint32_t crc; // Over data
+    T data;
+  };
+
+  bool load() {
+    Blob blob;
+    if (_prefs.getBytesLength("save") != sizeof(blob) ||
+        _prefs.getBytes("save", &blob, sizeof(blob)) != sizeof(blob))
+      return false;
+    if (blob.version != VERSION || blob.size != sizeof(T) ||
+        blob.crc != crc32(&blob.data, sizeof(T))) {
+      Serial.println("Save record invalid, ignoring it");
+      return false;
+    }
+    _blob = blob;
+    return true;
+  }
+
+  Preferences _prefs;
+  Blob _blob;
+  bool _dirty;
+  uint32_t _dirtySince;
+  Stats _stats;
+
+  // CRC-32 (IEEE), bitwise: a save is a few dozen bytes
+  static uint32_t crc32(const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t crc = 0xFFFFFFFF;
+    while (len--) {
+      crc ^= *p++;
+      for (int k = 0; k < 8; k++)
+        crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+  }
+};
+
+#endif
@@ -17,1032 +17,29 @@
 #define C_PURP 0xF81F // Purple/Magenta
 #define C_GREN 0x07E0 // Green
 
-// ============= SPRITE DIMENSIONS =============
-// Player ship: 32x32 pixels
-#define PLAYER_W 32
-#define PLAYER_H 32
-
-// Enemy ship: 24x24 pixels
-#define ENEMY_W 24
-#define ENEMY_H 24
-
-// Boss ship: 48x48 pixels
-#define BOSS_W 48
-#define BOSS_H 48
-
-// Bullet: 4x8 pixels
-#define BULLET_W 4
-#define BULLET_H 8
-
-// Power-up: 16x16 pixels
-#define POWERUP_W 16
-#define POWERUP_H 16
-
-// ============= BITMAP DATA =============
-// Format: RGB565 (16-bit color)
-// Use online tools like: https://javl.github.io/image2cpp/
-// or LVGL Image Converter to generate these arrays
-
-// ============= PLAYER SKINS =============
-// PLAYER SHIP DEFAULT (32x32)
-// Paste your bitmap data here:
-const uint16_t player_ship[PLAYER_W * PLAYER_H] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0841, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0862, 0x5b0d, 0xef9f, 0xffff, 0x6b4d, 0x0841, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xb5fa, 0xffff, 0xffff,
-    0xdedb, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x39e8, 0xe75f, 0xffff, 0xffff, 0xffff, 0x39c7, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x94d5, 0xf7df, 0xffff,
-    0xffff, 0xffff, 0xb596, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x18c3, 0xdf1f, 0xe73c, 0x6b6e, 0x6b6e, 0xe73c, 0xffff, 0xe73c,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1081,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x73b0, 0xa535, 0x1083,
-    0x42af, 0x4b2f, 0x10c3, 0xad75, 0x8c71, 0x1082, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x1081, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1060, 0x7b65, 0x1080, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1082, 0xc67c, 0x9492, 0x324e, 0x85be, 0x969e, 0x4b4f, 0x9492,
-    0xef7d, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x7b65, 0x1060,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2121,
-    0xde4a, 0x18a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0xdf3f, 0x9492,
-    0x324e, 0x85be, 0x969e, 0x4b4f, 0x9492, 0xffff, 0x2965, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x18a1, 0xde4a, 0x2101, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x28e1, 0x0840, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x31a7, 0xdf3f, 0x9492, 0x324e, 0x85be, 0x969e, 0x4b4f,
-    0x9492, 0xffff, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x28e1,
-    0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x71c5, 0xfbca, 0x6164, 0x0000, 0x0000, 0x0000, 0x0000, 0x31a7, 0xdf3f,
-    0x9492, 0x1947, 0x74fa, 0x85ba, 0x29c8, 0x9492, 0xffff, 0x39c7, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x6164, 0xfbca, 0x71c5, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x71c5, 0xfbca, 0x6164, 0x0000,
-    0x0000, 0x0000, 0x0862, 0x31a7, 0xdf3f, 0xf79e, 0x8c51, 0x10c3, 0x18e3,
-    0x8c51, 0xf79e, 0xffff, 0x39e7, 0x0841, 0x0000, 0x0000, 0x0000, 0x6164,
-    0xfbca, 0x71c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x71c5, 0xfbca, 0x6164, 0x0000, 0x0000, 0x18e3, 0x52ac, 0x31a7,
-    0xdf3f, 0xffff, 0xffff, 0xf7be, 0xf7be, 0xffff, 0xffff, 0xffff, 0x39e7,
-    0x630c, 0x1082, 0x0000, 0x0000, 0x6164, 0xfbca, 0x71c5, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x71c5, 0xfbca, 0x6164,
-    0x0000, 0x1082, 0x39e8, 0xadd9, 0x31c7, 0xdf3f, 0xffff, 0xffff, 0xffff,
-    0xffff, 0xffff, 0xffff, 0xffff, 0x39e7, 0xd69a, 0x4228, 0x0841, 0x0000,
-    0x6164, 0xfbca, 0x71c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x71c5, 0xfbca, 0x6164, 0x0000, 0x10a3, 0xbe5c, 0xce7a,
-    0x31c7, 0xdf3f, 0xffff, 0xad55, 0x1041, 0x1061, 0xad55, 0xffff, 0xffff,
-    0x39e7, 0xd69a, 0xef5d, 0x1082, 0x0000, 0x6164, 0xfbca, 0x71c5, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x71c5, 0xfbca,
-    0x6164, 0x0000, 0x9516, 0xef9f, 0xd69a, 0x31c7, 0xdf3f, 0xf7be, 0x20a2,
-    0xca89, 0xcb08, 0x20e3, 0xf7be, 0xffff, 0x39e7, 0xd69a, 0xffff, 0xbdd7,
-    0x0000, 0x6164, 0xfbca, 0x71c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x71c5, 0xfbca, 0x4144, 0x632e, 0xdf3f, 0xffff,
-    0xd69a, 0x31c7, 0xdf3f, 0x8c30, 0x60c4, 0xfb4b, 0xfbca, 0x61a5, 0x8c51,
-    0xffff, 0x39e7, 0xd69a, 0xffff, 0xffff, 0x738e, 0x4123, 0xfbca, 0x71c5,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x71c5,
-    0xaa87, 0x2966, 0xcede, 0xffff, 0xffff, 0xd69a, 0x31c7, 0xdf3f, 0x62aa,
-    0xa148, 0xfb4b, 0xfbca, 0xaa87, 0x630b, 0xffff, 0x39e7, 0xd69a, 0xffff,
-    0xffff, 0xffdf, 0x3185, 0xa267, 0x71c5, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5943, 0x18a3, 0xadda, 0xf7bf, 0xffff,
-    0xffff, 0xd69a, 0x31c7, 0xdf3f, 0x62aa, 0xa148, 0xfb4b, 0xfbca, 0xaa87,
-    0x630b, 0xffff, 0x39e7, 0xd69a, 0xffff, 0xffff, 0xffff, 0xdefb, 0x1882,
-    0x5123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x8453, 0xe77f, 0xffff, 0xffff, 0xffff, 0xd69a, 0x31c7, 0xdf3f,
-    0x62aa, 0xa148, 0xfb4b, 0xfbca, 0xaa87, 0x630b, 0xffff, 0x39e7, 0xd69a,
-    0xffff, 0xffff, 0xffff, 0xffff, 0xa514, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x4a6b, 0xdf1f, 0xffff, 0xffff,
-    0xffff, 0xffff, 0xd69a, 0x31c7, 0xdf3f, 0x62aa, 0xa148, 0xfb4b, 0xfbca,
-    0xaa87, 0x630b, 0xffff, 0x39e7, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff,
-    0xffff, 0x5aca, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x18e4, 0xc69d, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0x31c7,
-    0xdf3f, 0x62aa, 0xa148, 0xfb0b, 0xfb6b, 0xaa47, 0x62eb, 0xf7df, 0x39e7,
-    0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0x18e3, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xa558, 0xef9f, 0xffff, 0xffff,
-    0xffff, 0xffff, 0xffff, 0xd69a, 0x2145, 0x9d16, 0x41a7, 0x78e5, 0xb968,
-    0xb968, 0x78e5, 0x41a7, 0x9d16, 0x2145, 0xd69a, 0xffff, 0xffff, 0xffff,
-    0xffff, 0xffff, 0xffff, 0xce59, 0x0861, 0x0000, 0x0000, 0x0000, 0x18c3,
-    0x6b90, 0xe75f, 0xffff, 0xbdf7, 0xc638, 0x9cd3, 0xef7d, 0xffff, 0xd69a,
-    0x1081, 0x5203, 0x5265, 0x51e4, 0x51e4, 0x51e4, 0x51e4, 0x5265, 0x5265,
-    0x10a1, 0xd69a, 0xffff, 0xef7d, 0x94b2, 0xce59, 0xbdf7, 0xffff, 0xffff,
-    0x8c51, 0x1082, 0x0000, 0x0861, 0x31a7, 0xd6ff, 0xffff, 0xffff, 0xce79,
-    0xd6ba, 0xb5b6, 0xf79e, 0xffff, 0xd69a, 0x3962, 0xfde9, 0xff4b, 0xff4b,
-    0xff4b, 0xff4b, 0xff4b, 0xff4b, 0xff4b, 0x39c4, 0xd69a, 0xffff, 0xf79e,
-    0xb596, 0xdedb, 0xce79, 0xffff, 0xffff, 0xffff, 0x4208, 0x0841, 0x0020,
-    0x2987, 0x4249, 0x4249, 0x4a49, 0x4a49, 0x4a49, 0x4249, 0x4249, 0x4249,
-    0x39c7, 0x1061, 0x51a3, 0x5224, 0x5224, 0x5224, 0x5224, 0x5224, 0x5224,
-    0x5224, 0x1081, 0x39c7, 0x4249, 0x4249, 0x4249, 0x4a49, 0x4a49, 0x4a49,
-    0x4249, 0x4249, 0x31a6, 0x0000, 0x0021, 0x5376, 0x6cd6, 0x6cd6, 0x6cd6,
-    0x6cd6, 0x6cd6, 0x6cd6, 0x6cd6, 0x6cd6, 0x322a, 0x60c4, 0xba28, 0xbac7,
-    0xbac7, 0xbac7, 0xbac7, 0xbac7, 0xbac7, 0xbac7, 0x6184, 0x324a, 0x6cd6,
-    0x6cd6, 0x6cd6, 0x6cd6, 0x6cd6, 0x6cd6, 0x6cd6, 0x6cd6, 0x6cd6, 0x0020,
-    0x0041, 0x74de, 0x969e, 0x969e, 0x969e, 0x969e, 0x969e, 0x969e, 0x969e,
-    0x969e, 0x20a3, 0xd1aa, 0xfb8b, 0xfbca, 0xfbca, 0xfbca, 0xfbca, 0xfbca,
-    0xfbca, 0xfbca, 0xdb29, 0x18c3, 0x969e, 0x969e, 0x969e, 0x969e, 0x969e,
-    0x969e, 0x969e, 0x969e, 0x969e, 0x0021, 0x0000, 0x0883, 0x0882, 0x0882,
-    0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x3882, 0xfa8b, 0xfbca,
-    0xfbca, 0xfbca, 0xfbca, 0xfbca, 0xfbca, 0xfbca, 0xfbca, 0xfbca, 0x30e3,
-    0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1841, 0x9927, 0xfb2b, 0xfbca, 0xfbca, 0xfbca, 0xfbca, 0xfbca,
-    0xfbca, 0xfbca, 0xfbca, 0xfbca, 0x9a46, 0x1020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xf1cb, 0xfa2c,
-    0xfa2b, 0xfa2b, 0xfa2b, 0xfa2b, 0xfa2b, 0xfa2b, 0xfa2b, 0xfa2b, 0xfa2b,
-    0xf20b, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0xda2a,
-    0x1841, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000};
-
-// SKIN 1 - AZUL (Placeholder - reemplazar con bitmap real)
-const uint16_t player_ship_blue[PLAYER_W * PLAYER_H] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x247c, 0x245c, 0x245c, 0x0000, 0x0000, 0x245c,
-    0x245c, 0x247c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x041f, 0x245c,
-    0x245c, 0x245c, 0x0000, 0x0000, 0x245c, 0x245c, 0x245c, 0x055f, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1c5d, 0x245c, 0x245c, 0x245c, 0x0000, 0x0000,
-    0x245c, 0x245c, 0x245c, 0x243c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x247c,
-    0x245c, 0x245c, 0x245c, 0x0000, 0x0000, 0x245c, 0x245c, 0x245c, 0x247c,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x245c, 0x245c, 0x245c, 0x245c, 0x0000,
-    0x0000, 0x245c, 0x245c, 0x245c, 0x245c, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x0000, 0x0000, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x247b, 0x1c3c, 0x245c, 0x245c, 0x245c, 0x245c, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c7c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x2cbd, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x247d, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x247c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x055f, 0x055f, 0x245c, 0x245c, 0x245c, 0x245c, 0x247c,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x0000, 0x0000,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x0000, 0x0000, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x1c5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1c1c, 0x245c, 0x245c, 0x245c, 0x245c, 0x0000,
-    0x0000, 0x245c, 0x245c, 0x245c, 0x245c, 0x1c7c, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x0000, 0x0000, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x055f, 0x055f, 0x245c, 0x245c, 0x245c, 0x247c, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x247c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x247c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245d, 0x245c, 0x245c, 0x245c, 0x247c, 0x247c, 0x245c,
-    0x245c, 0x245c, 0x245d, 0x245c, 0x245c, 0x245c, 0x245c, 0x247c, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x055f, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x247c, 0x245c,
-    0x245c, 0x245c, 0x0000, 0x0000, 0x247c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x055f, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x245c, 0x245c, 0x247c, 0x0000, 0x34df, 0x247d, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x247c, 0x245c, 0x245c, 0x247c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x247c, 0x07ff, 0x0000, 0x247c, 0x245c, 0x1c5c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x247c, 0x245c, 0x247c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x247c, 0x247c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x247c, 0x247c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x247c, 0x247c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x0000, 0x0000, 0x247c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x247c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x247c, 0x245c, 0x245c, 0x0000, 0x0000, 0x247d, 0x245c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x247c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x247c,
-    0x041f, 0x0000, 0x245c, 0x245c, 0x247c, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x243c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x247c,
-    0x245c, 0x245c, 0x245c, 0x247c, 0x245c, 0x245c, 0x245c, 0x247c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x245c, 0x2c3c, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x245c, 0x247c, 0x0000, 0x245c, 0x245c, 0x245c, 0x247c,
-    0x245c, 0x245c, 0x0000, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x245c, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x247c, 0x245c, 0x245c,
-    0x245c, 0x245c, 0x247c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000};
-
-// SKIN 2 - ROJO (Placeholder - reemplazar con bitmap real)
-const uint16_t player_ship_red[PLAYER_W * PLAYER_H] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x6b4d, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x632c, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c,
-    0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x7bef, 0x9cf3, 0x4228, 0x4228,
-    0x9cf3, 0x7bef, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x632c,
-    0x630c, 0x94b2, 0x9cf3, 0x4a69, 0x4a69, 0x9cf3, 0x94b2, 0x630c, 0x630c,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0x630c, 0x0000, 0x4208,
-    0x4208, 0x0000, 0x630c, 0x630c, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x630c, 0x630c, 0x8c51, 0x9cf3, 0x4a69, 0x4a69, 0x9cf3, 0x8c51, 0x630c,
-    0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0x8c51, 0x9cf3,
-    0x4a69, 0x4a69, 0x9cf3, 0x8c51, 0x630c, 0x630c, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x630c, 0xa2cb, 0x630c, 0x632c, 0x0000, 0x4208, 0x4208, 0x0000, 0x632c,
-    0x630c, 0xa2cb, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x82eb, 0xd2aa, 0x632c, 0x9cf3,
-    0x632c, 0x4a69, 0x4a69, 0x632c, 0x9cf3, 0x632c, 0xd2aa, 0x82eb, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x9aeb, 0xea8a, 0x6b4d, 0x9cf3, 0x4208, 0x52aa, 0x52aa, 0x4208,
-    0x9cf3, 0x6b4d, 0xea8a, 0x9aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0xcaaa,
-    0x0000, 0x4208, 0x6b6d, 0x6b6d, 0x4208, 0x0000, 0xcaaa, 0x630c, 0x630c,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x630c, 0x630c, 0xcaaa, 0x5aeb, 0x528a, 0x9aeb, 0xaaeb,
-    0x9a69, 0x5aeb, 0xcaaa, 0x630c, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xea8a, 0xea8a,
-    0x630c, 0x630c, 0xea8a, 0x92eb, 0x630c, 0x630c, 0x630c, 0x630c, 0xea8a,
-    0xea8a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xd2aa, 0x92eb, 0xc2ca, 0xc2ca, 0x92eb, 0xaacb,
-    0x630c, 0x630c, 0xc2ca, 0xc2ca, 0x92eb, 0xd2aa, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa2cb,
-    0x630c, 0xc2ca, 0xc2ca, 0x630c, 0xc2ca, 0x72eb, 0x92eb, 0xc2ca, 0xc2ca,
-    0x630c, 0xa2cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0x630c, 0x630c, 0x4228,
-    0x72eb, 0x6aeb, 0x8a69, 0x630c, 0x630c, 0x630c, 0x630c, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x6b6d,
-    0x92cb, 0xea8a, 0x632c, 0x73ae, 0x528a, 0x6b4d, 0x6b4d, 0x528a, 0x73ae,
-    0x632c, 0xea8a, 0x92cb, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x4208, 0x4208,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208,
-    0x4208, 0x0000, 0x0000, 0x630c, 0x630c, 0x92eb, 0xea8a, 0x6b4d, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0xea8a, 0x92eb, 0x630c,
-    0x630c, 0x0000, 0x0000, 0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0x4208, 0x0000, 0x630c, 0x630c,
-    0x630c, 0x630c, 0x630c, 0xcaaa, 0x0000, 0x4208, 0x632c, 0x632c, 0x4208,
-    0x0000, 0xcaaa, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x0000, 0x4208,
-    0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x52aa, 0x5acb, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0xb2eb,
-    0x73ae, 0x632c, 0x6b4d, 0x6b4d, 0x632c, 0x73ae, 0xb2eb, 0x630c, 0x5aeb,
-    0x630c, 0x630c, 0x630c, 0x630c, 0x5acb, 0x52aa, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x828a, 0xc2ca, 0x630c, 0x630c,
-    0x630c, 0x0000, 0x0000, 0x630c, 0x632c, 0x73ae, 0x632c, 0x632c, 0x632c,
-    0x632c, 0x73ae, 0x632c, 0x630c, 0x0000, 0x0000, 0x630c, 0x630c, 0x5aeb,
-    0xc2ca, 0x828a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x52aa, 0x630c, 0x82eb, 0xc2ca, 0x630c, 0x630c, 0x0000, 0x5aeb,
-    0x630c, 0x0000, 0x4208, 0x4208, 0x4208, 0x4208, 0x0000, 0x630c, 0x630c,
-    0x0000, 0x630c, 0x630c, 0xc2ca, 0x82eb, 0x630c, 0x52aa, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5acb, 0xa2cb, 0xb2cb,
-    0xc2ca, 0xc2ca, 0x82eb, 0x630c, 0x630c, 0x630c, 0x632c, 0x4208, 0x4208,
-    0x4208, 0x4208, 0x632c, 0x630c, 0x630c, 0x630c, 0x82eb, 0xc2ca, 0xc2ca,
-    0xb2cb, 0xa2cb, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0x630c, 0xc2ca, 0xc2ca, 0xc2ca,
-    0x82eb, 0x5aeb, 0x8c51, 0x73ae, 0x4208, 0x4208, 0x73ae, 0x8c51, 0x630c,
-    0x82eb, 0xc2ca, 0xc2ca, 0xc2ca, 0x630c, 0x5aeb, 0x630c, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x630c, 0x630c, 0xc2ca, 0xcaaa, 0x630c, 0x630c, 0xea8a, 0xa410, 0x73ae,
-    0x4208, 0x4208, 0x73ae, 0xa410, 0xea8a, 0x630c, 0x630c, 0xcaaa, 0xc2ca,
-    0x630c, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0xc2ca,
-    0x630c, 0x630c, 0xea8a, 0xb2aa, 0x4208, 0x4208, 0x4208, 0x4208, 0xb2aa,
-    0xea8a, 0x630c, 0x630c, 0xc2ca, 0x630c, 0x630c, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0xea8a, 0xea8a, 0x630c, 0x94b2,
-    0x7bef, 0x4208, 0x4208, 0x7bef, 0x94b2, 0x630c, 0xea8a, 0xea8a, 0x630c,
-    0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x630c, 0x92eb, 0x92eb, 0x630c, 0x7bef, 0x632c, 0x4208, 0x4208, 0x632c,
-    0x7bef, 0x630c, 0x92eb, 0x92eb, 0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x632c, 0x5aeb, 0xc2ca, 0xc2ca,
-    0x630c, 0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0xc2ca, 0xc2ca, 0x630c,
-    0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5acb, 0x82eb, 0xa2cb, 0xa2cb, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xa2cb, 0xa2cb, 0x82eb, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c,
-    0x9acb, 0xb2aa, 0x0000, 0x0000, 0x0000, 0x0000, 0xb2aa, 0x9aeb, 0x630c,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9acb, 0xaacb, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xaacb, 0x9acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000};
-
-// SKIN 3 - VERDE (Placeholder - reemplazar con bitmap real)
-const uint16_t player_ship_green[PLAYER_W * PLAYER_H] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x45ca, 0x45ea, 0x45ea, 0x45ea, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45ea, 0x45ea, 0x45ea,
-    0x460a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4e4b, 0x3e0a, 0x4e4b, 0x3e29, 0x3e0a, 0x45ca, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e0b, 0x3e0a, 0x0000,
-    0x0000, 0x3e0a, 0x45ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x3e0a, 0x3e0a, 0x3e0b, 0x3e0b, 0x3e0a, 0x3e0a, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45ca, 0x3e0a, 0x3e0a,
-    0x45ea, 0x45ea, 0x3e0a, 0x3e0a, 0x45ca, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x45ea, 0x3e0a, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e0a,
-    0x45ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e0a, 0x3e0a,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x460a, 0x3e0a, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3e0a, 0x3e0b, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x45ea, 0x460a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45eb, 0x45ea,
-    0x0000, 0x3e0a, 0x3e0a, 0x3e0a, 0x460a, 0x0000, 0x460a, 0x45eb, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x45eb, 0x3e0a, 0x0000, 0x366c, 0x3e0a, 0x3e0a,
-    0x366c, 0x0000, 0x3e0a, 0x45ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e0b,
-    0x460a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45ea, 0x45ea,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x460a, 0x3e0a, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x460a, 0x45ea, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x460a, 0x460a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45eb,
-    0x460a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45eb, 0x460a, 0x0000, 0x07f0,
-    0x45ea, 0x460a, 0x07e0, 0x0000, 0x45eb, 0x45eb, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x45eb, 0x460a, 0x0000, 0x45ea, 0x45ea, 0x45ea, 0x460a, 0x0000,
-    0x45eb, 0x45eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45eb, 0x460a, 0x0000,
-    0x45eb, 0x45eb, 0x45eb, 0x45eb, 0x0000, 0x45eb, 0x45eb, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e0a, 0x460a, 0x460b,
-    0x3e29, 0x460a, 0x3e0a, 0x460a, 0x0000, 0x45eb, 0x45eb, 0x45eb, 0x45eb,
-    0x0000, 0x45eb, 0x3e0a, 0x460a, 0x3e29, 0x3e0a, 0x460a, 0x460b, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x460a, 0x0000, 0x460a, 0x3e0b, 0x45ea, 0x3e0b, 0x460a,
-    0x0000, 0x45eb, 0x45eb, 0x45eb, 0x45eb, 0x0000, 0x45eb, 0x45ea, 0x460a,
-    0x3e0b, 0x460a, 0x0000, 0x460a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x45ea, 0x45eb, 0x45ea, 0x45ea, 0x460a, 0x460a, 0x0000,
-    0x460a, 0x460a, 0x0000, 0x45eb, 0x460a, 0x0000, 0x45eb, 0x45eb, 0x45eb,
-    0x45eb, 0x0000, 0x45eb, 0x45eb, 0x0000, 0x3e0b, 0x460a, 0x0000, 0x460a,
-    0x460a, 0x45ea, 0x45ea, 0x45eb, 0x462a, 0x0000, 0x0000, 0x3e0a, 0x3e0a,
-    0x3e0a, 0x3e0a, 0x45ea, 0x460a, 0x0000, 0x460a, 0x0000, 0x0000, 0x45eb,
-    0x460a, 0x0000, 0x45eb, 0x460a, 0x460a, 0x45eb, 0x0000, 0x45eb, 0x45eb,
-    0x0000, 0x0000, 0x460a, 0x0000, 0x460a, 0x3e0a, 0x3e0a, 0x3e0a, 0x3e0a,
-    0x45ea, 0x0000, 0x0000, 0x45eb, 0x45eb, 0x45eb, 0x460a, 0x554a, 0x460b,
-    0x460a, 0x45ea, 0x0000, 0x0000, 0x45eb, 0x460a, 0x0000, 0x45eb, 0x3e0a,
-    0x3e0a, 0x45eb, 0x0000, 0x45eb, 0x45eb, 0x0000, 0x0000, 0x460b, 0x460a,
-    0x3e0a, 0x554a, 0x460b, 0x45eb, 0x45eb, 0x45eb, 0x0000, 0x0000, 0x45eb,
-    0x45eb, 0x45eb, 0x45eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x3e0b, 0x3e0a, 0x0000, 0x45eb, 0x45eb, 0x45eb, 0x45eb, 0x0000, 0x45ea,
-    0x3e0b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45eb, 0x45eb,
-    0x45eb, 0x45eb, 0x0000, 0x0000, 0x45eb, 0x45eb, 0x45eb, 0x460a, 0x460b,
-    0x460b, 0x460b, 0x460b, 0x460b, 0x460b, 0x460a, 0x45ea, 0x0000, 0x45ea,
-    0x45ea, 0x45ea, 0x460b, 0x0000, 0x460b, 0x3e0a, 0x45ea, 0x45ea, 0x45ea,
-    0x45ea, 0x45ea, 0x45ea, 0x3e0a, 0x45eb, 0x45eb, 0x45eb, 0x0000, 0x0000,
-    0x3e0a, 0x460a, 0x460a, 0x3e0a, 0x3e0a, 0x3e0a, 0x45ea, 0x45ea, 0x45ea,
-    0x45ea, 0x3e0a, 0x45ea, 0x0000, 0x07e0, 0x460a, 0x460b, 0x07e0, 0x0000,
-    0x3e0a, 0x3e0a, 0x45ea, 0x45ea, 0x45ea, 0x45ea, 0x3e0a, 0x3e0a, 0x3e0a,
-    0x460a, 0x460a, 0x45ea, 0x0000, 0x0000, 0x462a, 0x45ea, 0x45ea, 0x462a,
-    0x45ea, 0x45ea, 0x460b, 0x460b, 0x460b, 0x460b, 0x460a, 0x3e0a, 0x3e29,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x45ca, 0x45ea, 0x460a, 0x460b, 0x460b,
-    0x460b, 0x460b, 0x45ea, 0x460b, 0x462a, 0x45ea, 0x45ea, 0x462a, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07e0, 0x460a, 0x45ea, 0x45ea,
-    0x45ea, 0x45ea, 0x45ea, 0x3e0a, 0x3e0b, 0x460b, 0x460b, 0x460b, 0x460b,
-    0x460a, 0x3e0a, 0x45ea, 0x45ea, 0x45ea, 0x45ea, 0x45ea, 0x460b, 0x07e0,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45ea,
-    0x45ea, 0x45ea, 0x45ea, 0x45ea, 0x45ea, 0x45ea, 0x45ea, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x460a, 0x45ea, 0x460b, 0x460b, 0x460b,
-    0x460b, 0x45ea, 0x460a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x45eb, 0x45ea, 0x45ea, 0x45ea, 0x45ea, 0x45ea, 0x45ea, 0x45eb, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000};
-
-// ENEMY SHIP (24x24)
-// Paste your bitmap data here:
-const uint16_t enemy_ship[ENEMY_W * ENEMY_H] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2905, 0x4987,
-    0x4987, 0x2925, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x61c8, 0x61c8, 0x2104, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x29a8, 0x322b, 0x322b, 0x2125, 0x2104, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x32cf, 0x3b31,
-    0x3b31, 0x29a8, 0x20e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2167, 0x32ae, 0x3b31, 0x3b31, 0x324b, 0x2124,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x2987, 0x3b31, 0x322b, 0x322b, 0x32ce, 0x2125, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e4, 0x2145, 0x32f0, 0x2124,
-    0x2124, 0x32f0, 0x2145, 0x20e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945,
-    0x2945, 0x0000, 0x2124, 0x328d, 0x31e9, 0x3186, 0x3186, 0x3209, 0x328d,
-    0x2125, 0x0000, 0x4000, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x20e3, 0x2904, 0x2104, 0x2945, 0x2966,
-    0x32cf, 0x3186, 0x6390, 0x63b0, 0x2986, 0x32cf, 0x2966, 0x2945, 0x2104,
-    0x2904, 0x20e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x2904, 0x59a7, 0x2104, 0x4208, 0x31e9, 0x31e9, 0x6390, 0x2966,
-    0x2966, 0x6370, 0x31e9, 0x31e9, 0x4208, 0x2104, 0x5186, 0x2904, 0x28a2,
-    0x0000, 0x0000, 0x0000, 0x2104, 0x18e3, 0x0000, 0x0000, 0x2904, 0x8a4a,
-    0x73f0, 0xa5b7, 0x31e9, 0x31a7, 0x2945, 0x328d, 0x328d, 0x2945, 0x31a7,
-    0x31e9, 0xa5b7, 0x7c31, 0x7a09, 0x3125, 0x28c3, 0x0000, 0x18e3, 0x2104,
-    0x2943, 0x3144, 0x2943, 0x2965, 0x2924, 0x824a, 0x8cd3, 0xa5b7, 0x2124,
-    0x2104, 0x324c, 0x3b31, 0x3b31, 0x324c, 0x2104, 0x2124, 0xa5b7, 0x9535,
-    0x7209, 0x3945, 0x2965, 0x2943, 0x3144, 0x2923, 0x3144, 0xe5e4, 0x2944,
-    0x7410, 0x2104, 0x3165, 0xb67a, 0xa5b7, 0x31c8, 0x3af0, 0x3b31, 0x3b31,
-    0x3b31, 0x3b31, 0x3af0, 0x31c8, 0xa5b7, 0xbebc, 0x3986, 0x2104, 0x6baf,
-    0x2944, 0xe5e4, 0x3144, 0x3144, 0xee04, 0x3164, 0xcf3e, 0x73f0, 0xc6fc,
-    0xd77f, 0xa5b7, 0x31e9, 0x3b31, 0x3b31, 0x3b31, 0x3b31, 0x3b31, 0x3b31,
-    0x31e9, 0xa5b7, 0xd77f, 0xc6fd, 0x73f0, 0xcf3e, 0x3164, 0xee04, 0x3144,
-    0x3144, 0xee04, 0x3164, 0xcf3e, 0xd77f, 0xd77f, 0xd77f, 0x8cd4, 0x2945,
-    0x32ef, 0x3b31, 0x3b31, 0x3b31, 0x3b31, 0x32cf, 0x2945, 0x8cd4, 0xd77f,
-    0xd77f, 0xd77f, 0xcf5e, 0x3164, 0xee04, 0x3144, 0x3144, 0xee04, 0x3164,
-    0xcf3e, 0xd77f, 0xcf1d, 0xadf9, 0x31a6, 0x2945, 0x2145, 0x326c, 0x326d,
-    0x326d, 0x324c, 0x2125, 0x2946, 0x31a6, 0xadf9, 0xcf1d, 0xd77f, 0xcf5e,
-    0x3164, 0xee04, 0x3144, 0x3144, 0xee04, 0x3164, 0x4249, 0x2965, 0x2945,
-    0x2124, 0x3186, 0x31e9, 0x328d, 0x29c9, 0x29c9, 0x29c9, 0x29c9, 0x32ae,
-    0x31e9, 0x3186, 0x2924, 0x2945, 0x2965, 0x4249, 0x3164, 0xee04, 0x3144,
-    0x2944, 0x41a4, 0x2104, 0x20e3, 0x2124, 0x3186, 0x2945, 0x8493, 0x31e9,
-    0x3b31, 0x3b31, 0x3b31, 0x3b31, 0x3b31, 0x3b31, 0x31e9, 0x8493, 0x2945,
-    0x3186, 0x2124, 0x20e3, 0x2104, 0x41a4, 0x2944, 0x18e3, 0x20e3, 0x2104,
-    0x0000, 0x0000, 0x2124, 0x52ec, 0xa5b7, 0x31e8, 0x3b31, 0x328d, 0x2924,
-    0x2924, 0x32cf, 0x3b31, 0x31e8, 0xa5b7, 0x5aec, 0x2124, 0x0000, 0x0000,
-    0x2104, 0x20e3, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x4000, 0x2945,
-    0xae19, 0x4a49, 0x2104, 0x29a7, 0x3165, 0x93c4, 0x7b44, 0x3186, 0x2987,
-    0x2104, 0x4a49, 0xae19, 0x2945, 0x4000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0x4a8a, 0x4249, 0x2965, 0x4000,
-    0x2104, 0x3165, 0x3184, 0x3184, 0x3165, 0x2104, 0x0000, 0x2945, 0x4249,
-    0x52ab, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x3186, 0x2945, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x2945, 0x3186, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x2945,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2945, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000};
-
-// BOSS SHIP (48x48)
-// Paste your bitmap data here:
-const uint16_t boss_ship[BOSS_W * BOSS_H] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x630c, 0x630c, 0x630c, 0x630c, 0x73ae,
-    0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x630c, 0x630c,
-    0x630c, 0x630c, 0x73ae, 0x73ae, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae,
-    0x73ae, 0x630c, 0x630c, 0x630c, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x632c, 0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c, 0x630c, 0x630c, 0x73ae,
-    0x73ae, 0x73ae, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x630c, 0x630c, 0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c,
-    0x630c, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x0000, 0x630c, 0x630c,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0x8410, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x630c, 0x630c, 0x630c, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x6b6d, 0x630c, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c, 0x630c, 0x630c, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x630c, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x630c, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x6b6d, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x632c, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c, 0x630c, 0x630c, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c,
-    0x630c, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x630c, 0x630c, 0x630c, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c, 0x630c, 0x630c, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x8410, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c,
-    0x630c, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x738e, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x630c, 0x630c, 0x630c, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c, 0x630c, 0x630c, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x8430, 0xbdf7, 0xbdf7,
-    0xbdf7, 0xbdf7, 0x8430, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x738e, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0xad55, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xad55, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x73ae, 0x8430, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7,
-    0x8430, 0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x7bcf, 0x73ae, 0x73ae, 0xad55, 0xbdf7, 0xbdf7, 0xbdf7,
-    0xbdf7, 0xbdf7, 0xbdf7, 0xad55, 0x73ae, 0x73ae, 0x7bcf, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x8430, 0xbdf7,
-    0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0x8430, 0x73ae,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x73ae, 0xad55, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7,
-    0xbdf7, 0xad55, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x7bcf,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae,
-    0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3,
-    0x9cf3, 0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x9cf3,
-    0x9cf3, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3,
-    0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3,
-    0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x630c, 0x630c, 0x630c, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae,
-    0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c, 0x630c,
-    0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae,
-    0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3,
-    0x9cf3, 0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3, 0x630c, 0x630c, 0x630c,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x9cf3,
-    0x9cf3, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x630c, 0x630c, 0x630c, 0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3,
-    0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3,
-    0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae,
-    0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae,
-    0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3,
-    0x9cf3, 0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3, 0x630c, 0x630c, 0x630c,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x9cf3,
-    0x9cf3, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x630c, 0x630c, 0x630c, 0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3,
-    0x630c, 0x630c, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3,
-    0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x630c, 0x630c, 0x630c, 0x9cf3, 0x9cf3, 0x9cf3,
-    0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae,
-    0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x9cf3, 0xea8a, 0xea8a, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae,
-    0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0xa514, 0xa514,
-    0x9cf3, 0xcb8d, 0xd36d, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xd36d, 0xcb8d, 0x9cf3,
-    0xa514, 0xa514, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-    0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae,
-    0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x73ae,
-    0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3,
-    0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0x630c, 0x0000, 0x0000, 0x630c,
-    0x630c, 0x630c, 0x0000, 0x0000, 0x630c, 0x630c, 0x630c, 0x0000, 0x0000,
-    0x630c, 0x630c, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0x630c,
-    0x0000, 0x0000, 0x630c, 0x630c, 0x630c, 0x0000, 0x0000, 0x630c, 0x630c,
-    0x630c, 0x0000, 0x0000, 0x630c, 0x630c, 0x630c, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x630c, 0x630c, 0x0000,
-    0x0000, 0x630c, 0x630c, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000};
-
-// BULLET (4x8)
-// Paste your bitmap data here:
-const uint16_t bullet_sprite[BULLET_W * BULLET_H] PROGMEM = {
-    0x0000, 0x2942, 0x3100, 0x0000, 0x2945, 0x9c27, 0xa3a1, 0x3100,
-    0x528a, 0xf5e1, 0xfe01, 0x61e0, 0x8c50, 0xf602, 0xfe01, 0x92e0,
-    0xc5f5, 0xfe02, 0xfe01, 0xcc00, 0x39c6, 0x49e0, 0x51e0, 0x3940,
-    0xad0c, 0xc541, 0xc540, 0xb420, 0xf731, 0xfee2, 0xfee1, 0xfdc0};
-
-// POWER-UP SHIELD (16x16)
-const uint16_t powerup_shield[POWERUP_W * POWERUP_H] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe73c, 0xe73c, 0xe73c, 0xd6bb,
-    0xdedb, 0xdefb, 0xd6ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe73c,
-    0xef5d, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xd69b, 0xd69b, 0xd69b,
-    0xd69b, 0xdedb, 0xdedb, 0xdedb, 0x0000, 0xdefb, 0xe73c, 0xe73c, 0xe73c,
-    0xdf1c, 0x9e9d, 0x561d, 0x159d, 0x04bf, 0x1d1e, 0x5dbd, 0xbe7b, 0xd69b,
-    0xd69b, 0xd69b, 0xce7b, 0xdefb, 0xe73c, 0xd71c, 0x3ddd, 0x057d, 0x055d,
-    0x055d, 0x055d, 0x04bf, 0x04bf, 0x04bf, 0x04bf, 0x0cff, 0xae5b, 0xd69b,
-    0xce7b, 0xdefb, 0xe73c, 0xc6fc, 0x055d, 0x055d, 0x055d, 0x055d, 0x055d,
-    0x04bf, 0x04bf, 0x04bf, 0x04bf, 0x04bf, 0x963c, 0xd69b, 0xce7b, 0xffff,
-    0xe73c, 0xc6fc, 0x055d, 0x055d, 0x055d, 0x055d, 0x055d, 0x04bf, 0x04bf,
-    0x04bf, 0x04bf, 0x04bf, 0x9e3b, 0xd69b, 0xe73c, 0x0000, 0xef5d, 0xe73c,
-    0x055d, 0x055d, 0x055d, 0x055d, 0x055d, 0x04bf, 0x04bf, 0x04bf, 0x04bf,
-    0x04bf, 0xc69b, 0xd6bb, 0x0000, 0x0000, 0xe73c, 0xe73c, 0x1d9d, 0x055d,
-    0x055d, 0x055d, 0x055d, 0x04bf, 0x04bf, 0x04bf, 0x04bf, 0x04df, 0xd69b,
-    0xdedb, 0x0000, 0x0000, 0xef5d, 0xe73c, 0x561d, 0x055d, 0x055d, 0x055d,
-    0x055d, 0x04bf, 0x04bf, 0x04bf, 0x04bf, 0x1d1e, 0xd69b, 0xdedb, 0x0000,
-    0x0000, 0xe73c, 0xe73c, 0xb6dc, 0x055d, 0x055d, 0x055d, 0x055d, 0x04bf,
-    0x04bf, 0x04bf, 0x04bf, 0x861c, 0xd69b, 0xdefb, 0x0000, 0x0000, 0x0000,
-    0xe73c, 0xe73c, 0x45fd, 0x055d, 0x055d, 0x055d, 0x04bf, 0x04bf, 0x04bf,
-    0x14fe, 0xd69b, 0xd6bb, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xe73c,
-    0xd71c, 0x1d9d, 0x055d, 0x055d, 0x04bf, 0x04bf, 0x04df, 0xb67b, 0xd69b,
-    0xdefb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe73c, 0xe73c, 0xc6fc,
-    0x25bd, 0x055d, 0x04bf, 0x04df, 0x9e3c, 0xd69b, 0xdedb, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe73c, 0xe73c, 0xdf3c, 0x5e1d,
-    0x253e, 0xc67b, 0xd69b, 0xdedb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xffff, 0xe73c, 0xe73c, 0xe73c, 0xd69b, 0xd69b,
-    0xdedb, 0xd6bf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xe73c, 0xe73c, 0xd6bb, 0xdedb, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000};
-
-// POWER-UP WEAPON (16x16)
-const uint16_t powerup_weapon[POWERUP_W * POWERUP_H] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x65bf, 0x5dbf, 0x0000, 0x0000, 0x0000, 0xfde6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x65bf,
-    0x65bf, 0x65bf, 0x65bf, 0x0000, 0x0000, 0xfe05, 0x0000, 0x5dbf, 0x5dbf,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfde6, 0x5ddf, 0x65bf, 0x65bf,
-    0x5ddf, 0x5dbf, 0x65bf, 0xfde5, 0x65df, 0x5dbf, 0x65bf, 0x65bf, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xfde6, 0x0000, 0x5ddf, 0x5ddf, 0x5ddf, 0x65bf,
-    0x5dbf, 0x555f, 0x65bf, 0x65bf, 0x65bf, 0x657f, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xfde6, 0x0000, 0x0000, 0x65df, 0x65bf, 0x65bf, 0x65bf, 0x5dbf,
-    0x0000, 0x659f, 0x5dbf, 0xfde6, 0x0000, 0x0000, 0x0000, 0x0000, 0xfde5,
-    0x1e97, 0x26d6, 0x65bf, 0x65bf, 0x65bf, 0x65bf, 0x5dbf, 0x65bf, 0x1e97,
-    0x0000, 0xfe05, 0x0000, 0x0000, 0x0000, 0x0000, 0x1697, 0x1e77, 0x1e97,
-    0x0000, 0x5dbf, 0x65bf, 0x65bf, 0x65df, 0x1e97, 0x1e77, 0x1e97, 0xfde6,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1e77, 0x1e77, 0x1e77, 0x1e77, 0x5dbf,
-    0x65bf, 0x65bf, 0x65ff, 0x1e77, 0x1e77, 0x1e97, 0x07ff, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1e77, 0x1e97, 0xfde6, 0x5dbf, 0x65bf, 0x65bf,
-    0xe60b, 0x3e54, 0x1e77, 0x1e97, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1e77, 0x7650, 0xfde6, 0x8dd8, 0x65bf, 0x65be, 0xfde6, 0xde08,
-    0x1e77, 0x1e97, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e77,
-    0xb62b, 0xfde6, 0xbdf1, 0x65bf, 0x8dd8, 0xfe06, 0xe607, 0x3675, 0x1e77,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e97, 0x7650, 0xfde6,
-    0x8dd8, 0x65bf, 0x65bf, 0xfe07, 0xc62a, 0x1e77, 0x2eb5, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8e30, 0xddea, 0x8dd9, 0x65bf,
-    0x65bf, 0xddeb, 0xbe0a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x65df, 0x65bf, 0x65bf, 0x07ff,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000};
-
-// EXPLOSION FRAMES (16x16, 4 frames for animation)
-const uint16_t explosion_frame1[16 * 16] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf800,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc102, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x4a67, 0x4a68, 0xc102, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0xa143,
-    0x71e6, 0x6227, 0xc942, 0x5a27, 0xa164, 0xa800, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xc0e2, 0x9984, 0x4a68, 0x79c5, 0xc102, 0xc102,
-    0xdaa1, 0xb143, 0xc102, 0x5248, 0xf800, 0xc980, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x89a5, 0xb9a2, 0xb922, 0xda81, 0xe341, 0xf500, 0xe301,
-    0xc102, 0x91a4, 0x9184, 0x6a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x4a68, 0x81e5, 0xe301, 0xf4c0, 0xfe42, 0xfeea, 0xf560, 0xe301, 0xa183,
-    0x4a48, 0x4a48, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a68, 0x71e6, 0xb922,
-    0xe2e1, 0xfe22, 0xff50, 0xff71, 0xfe86, 0xe341, 0xc142, 0x9184, 0x5248,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x4a48, 0x4a48, 0xb163, 0xe381, 0xfe41,
-    0xff4f, 0xff71, 0xfec8, 0xec40, 0xc122, 0x5a27, 0x4a48, 0x0000, 0x0000,
-    0xa800, 0xc102, 0x99a4, 0xb203, 0xd241, 0xe2e1, 0xf4e0, 0xfe63, 0xfea7,
-    0xf500, 0xe301, 0xd201, 0xb183, 0x9185, 0xb8a2, 0x0000, 0x0000, 0x0000,
-    0x5288, 0x4a68, 0x71e6, 0xc982, 0xdaa1, 0xf4e0, 0xf540, 0xe341, 0xc9c1,
-    0xa164, 0x4a48, 0x71e6, 0xc122, 0xf800, 0x0000, 0x0000, 0x0000, 0x4a68,
-    0x79c6, 0x9184, 0xda81, 0xe2e1, 0xe341, 0xe2e1, 0x9984, 0x89a5, 0x5248,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0x4a68, 0x81c5,
-    0xa9e3, 0xa9e3, 0xb203, 0xa1e4, 0x81c5, 0x4a68, 0x4a68, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc0e1, 0xb143, 0x4a48, 0x89c5,
-    0x7206, 0x5247, 0x89a4, 0x4a68, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xc0e2, 0x0000, 0x0000, 0xc122, 0x89c4, 0x0000,
-    0xb942, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xf800, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000};
-
-const uint16_t explosion_frame2[16 * 16] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41c5, 0x41e5,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x2104, 0x4208, 0x0000, 0x0000, 0x0000, 0x5a25, 0x5a25, 0x0000, 0x2945,
-    0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3965, 0x49a6,
-    0x3165, 0x4965, 0x5165, 0x7285, 0x7285, 0x6186, 0x69a6, 0x4145, 0x0000,
-    0x2104, 0x2104, 0x0000, 0x2945, 0x2124, 0x18e3, 0x6a49, 0x51a6, 0xca49,
-    0xb228, 0xab86, 0xabc6, 0xb228, 0xd269, 0x99e7, 0x59e7, 0x59e7, 0x4186,
-    0x0000, 0x0000, 0x2124, 0x3945, 0x89c7, 0x9a08, 0x81e7, 0x61e6, 0xece6,
-    0xece6, 0x71e6, 0xc249, 0xb228, 0x7a49, 0x49c7, 0x0000, 0x0000, 0x0000,
-    0x2904, 0x99e7, 0xd269, 0xd249, 0xdc86, 0xf527, 0xece6, 0xece6, 0xbc06,
-    0xcc26, 0xba28, 0x99e7, 0x4145, 0x0000, 0x0000, 0x0000, 0x2924, 0x89e7,
-    0xb228, 0x79c6, 0xece6, 0x8305, 0x6aa5, 0xf527, 0xa386, 0xece7, 0x6205,
-    0xa228, 0x5165, 0x0000, 0x0000, 0x41c5, 0x5a25, 0x6a45, 0xab86, 0xece6,
-    0xf527, 0xa3a6, 0x8b05, 0xf507, 0xdc86, 0xf527, 0xf527, 0xc426, 0x7ac5,
-    0x5a25, 0x41a4, 0x41c5, 0x5a25, 0x6245, 0xabc6, 0xece7, 0xbc06, 0xe4a6,
-    0xf527, 0x9b66, 0x6ac5, 0xdc86, 0xf507, 0xc426, 0x7aa5, 0x5a25, 0x41a4,
-    0x0000, 0x4145, 0xa208, 0xb228, 0x6a65, 0xf527, 0xf527, 0xece6, 0xe4c6,
-    0x9b65, 0xf507, 0xcc26, 0xa228, 0x79a6, 0x2104, 0x0000, 0x0000, 0x4965,
-    0xca49, 0xd269, 0xb2e7, 0xcc46, 0xb3c6, 0xece6, 0xf527, 0x82e5, 0x9325,
-    0xaae7, 0xd269, 0x91e7, 0x2124, 0x0000, 0x0000, 0x3165, 0x69a6, 0xba28,
-    0xd249, 0xaa08, 0x71e6, 0xece6, 0xece6, 0x8226, 0xca49, 0xa208, 0x71a6,
-    0x5186, 0x0000, 0x0000, 0x0000, 0x0000, 0x4186, 0x8a8a, 0x69a6, 0xd269,
-    0x91e7, 0xabc6, 0xabc6, 0xb228, 0xd269, 0x5186, 0x9aeb, 0x3965, 0x0000,
-    0x0000, 0x0000, 0x2945, 0x41a6, 0x5a08, 0x3965, 0x5165, 0x4165, 0x72a5,
-    0x7285, 0x5986, 0x4165, 0x2924, 0x51c7, 0x3986, 0x0000, 0x0000, 0x0000,
-    0x2104, 0x3965, 0x0000, 0x0000, 0x0000, 0x0000, 0x5a25, 0x5a25, 0x0000,
-    0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x41c5, 0x41c5, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000};
-const uint16_t explosion_frame3[16 * 16] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf526, 0xf547,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf527, 0xf527, 0x0000, 0xda49,
-    0xda69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe3cf, 0xe410,
-    0xdc10, 0xd269, 0xd269, 0xf507, 0xf507, 0xda69, 0xd249, 0xda49, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xd228, 0xd249, 0x0000, 0xe410, 0xe36d, 0xd269,
-    0xd269, 0xf4e7, 0xf4e7, 0xd269, 0xd269, 0xd269, 0xe3ef, 0xe410, 0xe3ef,
-    0x0000, 0x0000, 0xda69, 0xd269, 0xd269, 0xd269, 0xda89, 0xe368, 0xf527,
-    0xf527, 0xda89, 0xd269, 0xd269, 0xe3cf, 0xe410, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xd269, 0xd269, 0xd269, 0xf507, 0xf527, 0xf547, 0xf547, 0xf507,
-    0xf487, 0xd269, 0xd249, 0xda49, 0x0000, 0x0000, 0x0000, 0x0000, 0xda69,
-    0xd269, 0xda89, 0xf527, 0xf547, 0xfd87, 0xf527, 0xfda7, 0xf527, 0xdb08,
-    0xd269, 0xd269, 0x0000, 0x0000, 0xf526, 0xf527, 0xf487, 0xf4e7, 0xf527,
-    0xf527, 0xf527, 0xfd47, 0xf527, 0xf527, 0xf527, 0xf527, 0xf507, 0xf507,
-    0xf527, 0xf507, 0xf526, 0xf527, 0xf4e7, 0xf527, 0xf527, 0xfd87, 0xfd47,
-    0xf527, 0xf527, 0xfe27, 0xf527, 0xf527, 0xf507, 0xf4e7, 0xf527, 0xf507,
-    0x0000, 0xda69, 0xd269, 0xd269, 0xf4a7, 0xf527, 0xf527, 0xf547, 0xf527,
-    0xf527, 0xf527, 0xf487, 0xd249, 0xd269, 0x0000, 0x0000, 0x0000, 0xda69,
-    0xd269, 0xd269, 0xe388, 0xf527, 0xf507, 0xf547, 0xf527, 0xec67, 0xf487,
-    0xdac9, 0xd269, 0xd269, 0x0000, 0x0000, 0x0000, 0xfc10, 0xda69, 0xd269,
-    0xd269, 0xd269, 0xe328, 0xf527, 0xf527, 0xda89, 0xd269, 0xd269, 0xd269,
-    0xda49, 0x0000, 0x0000, 0x0000, 0x0000, 0xe410, 0xe3cf, 0xda8a, 0xd269,
-    0xd269, 0xf527, 0xf4e7, 0xd269, 0xd269, 0xdacb, 0xe3ef, 0xe410, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xe410, 0xe410, 0xdb4d, 0xda69, 0xd269, 0xf527,
-    0xf4e7, 0xd269, 0xd269, 0xfa08, 0xe410, 0xe410, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xec10, 0x0000, 0x0000, 0x0000, 0x0000, 0xf527, 0xf527, 0x0000,
-    0xda69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xf547, 0xf547, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000};
-
-const uint16_t explosion_frame4[16 * 16] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf4c5, 0xecc5, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xece5, 0xeca5, 0xece5, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xf4e5, 0xece6, 0xecc5, 0x0000, 0xf505, 0xffe0, 0x0000, 0xfc84,
-    0xf505, 0xf525, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xecc5, 0xecc5,
-    0xeda9, 0xed68, 0xf4e5, 0xf505, 0xf505, 0xf505, 0xf505, 0xf505, 0xf505,
-    0x0000, 0xeca5, 0xece5, 0xecc5, 0x0000, 0xecc5, 0xeca5, 0xed88, 0xf66b,
-    0xed06, 0xf505, 0xf525, 0xf5eb, 0xf567, 0xf505, 0x0000, 0x0000, 0xf4e5,
-    0xeca5, 0xeca5, 0xece6, 0xeca5, 0xeda9, 0xf68b, 0xf6a9, 0xf6ce, 0xf5eb,
-    0xf6f2, 0xf5ea, 0xf505, 0x0000, 0x0000, 0x0000, 0x0000, 0xece5, 0xecc5,
-    0xeda9, 0xf68b, 0xf6ac, 0xf6aa, 0xf6ee, 0xf732, 0xf734, 0xf64d, 0xf525,
-    0xf525, 0xf505, 0xf525, 0x0000, 0x0000, 0x0000, 0xf4c4, 0xecc5, 0xece6,
-    0xf6aa, 0xf710, 0xf734, 0xf734, 0xf734, 0xf6d1, 0xf62d, 0xf567, 0xf505,
-    0xf505, 0x0000, 0x0000, 0xf4c5, 0xeca5, 0xeca5, 0xed47, 0xf6ab, 0xf6ab,
-    0xf733, 0xf734, 0xf734, 0xf66e, 0xf546, 0xf505, 0xf505, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xece5, 0xece5, 0xed06, 0xf6aa, 0xf6a9, 0xf712, 0xf734,
-    0xf734, 0xf60b, 0xf505, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xecc5, 0xf68b, 0xf64b, 0xed68, 0xf734, 0xf68f, 0xf733, 0xf733,
-    0xf567, 0xf505, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xecc5, 0xed68,
-    0xed68, 0xecc5, 0xf526, 0xf6b0, 0xf505, 0xf568, 0xf6f1, 0xf6b0, 0xf525,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xecc5, 0xeca5, 0xecc5, 0xecc5, 0x0000,
-    0xf526, 0xf5a9, 0xf505, 0xf525, 0xf526, 0xf66e, 0xf60b, 0xf505, 0x0000,
-    0x0000, 0x0000, 0xecc5, 0xecc5, 0xfd45, 0x0000, 0x0000, 0xf525, 0xf525,
-    0x0000, 0x0000, 0xece4, 0xf505, 0xf5ca, 0xf546, 0xf4e6, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf505, 0xf505, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xf525, 0xf505, 0xf505, 0xffe0, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xf505, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xf525, 0xf505, 0xf525};
+// ============= SPRITES =============
+// Generated from sprites/*.png by tools/sprite_compiler.py (CMake target
+// `sprites`). Edit the PNGs, not Sprites.h.
+#include "Sprites.h"
+
+// Frame sizes come from the PNGs
+#define PLAYER_W (player_ship.w)
+#define PLAYER_H (player_ship.h)
+#define ENEMY_W (enemy_ship.w)
+#define ENEMY_H (enemy_ship.h)
+#define BOSS_W (boss_ship.w)
+#define BOSS_H (boss_ship.h)
+#define BULLET_W (bullet_sprite.w)
+#define BULLET_H (bullet_sprite.h)
+#define POWERUP_W (powerup_shield.w)
+#define POWERUP_H (powerup_shield.h)
 
 // Array de punteros a skins
-const uint16_t *player_skins[] = {
-    player_ship,      // Skin 0 - Default
-    player_ship_blue, // Skin 1 - Azul
-    player_ship_red,  // Skin 2 - Rojo
-    player_ship_green // Skin 3 - Verde
+const RunSprite *const player_skins[] = {
+    &player_ship,      // Skin 0 - Default
+    &player_ship_blue, // Skin 1 - Azul
+    &player_ship_red,  // Skin 2 - Rojo
+    &player_ship_green // Skin 3 - Verde
 };
 
 // ============= TIENDA =============
@@ -1061,47 +58,4 @@ SkinItem shopSkins[NUM_SKINS] = {
     {3, "Green", 200, false} // 200 monedas
 };
 
-// ============= HELPER FUNCTION =============
-// Draw a bitmap from PROGMEM to TFT_eSprite
-inline void drawBitmap(TFT_eSprite *sprite, int16_t x, int16_t y,
-                       const uint16_t *bitmap, int16_t w, int16_t h) {
-  for (int16_t j = 0; j < h; j++) {
-    for (int16_t i = 0; i < w; i++) {
-      uint16_t color = pgm_read_word(&bitmap[j * w + i]);
-      if (color != C_TRSP) { // Skip transparent pixels
-        sprite->drawPixel(x + i, y + j, color);
-      }
-    }
-  }
-}
-
 #endif
-
-/*
- * INSTRUCCIONES PARA CREAR BITMAPS:
- *
- * 1. Crea tus imágenes en un editor (GIMP, Photoshop, etc.)
- * 2. Redimensiona a los tamaños especificados arriba
- * 3. Usa una herramienta de conversión:
- *    - Online: https://javl.github.io/image2cpp/
- *      * Configuración: Code output format = "Arduino code"
- *      * Draw mode = "Horizontal"
- *      * Brightness = "RGB565"
- *
- *    - LVGL Image Converter: https://lvgl.io/tools/imageconverter
- *      * Output format = "C array"
- *      * Color format = "RGB565"
- *
- * 4. Copia el array generado y pégalo en la sección correspondiente arriba
- *
- * BITMAPS NECESARIOS:
- * - player_ship (32x32): Tu nave espacial
- * - enemy_ship (24x24): Nave enemiga básica
- * - boss_ship (48x48): Jefe final
- * - bullet_sprite (4x8): Disparo del jugador
- * - powerup_shield (16x16): Power-up de escudo
- * - powerup_weapon (16x16): Power-up de arma mejorada
- * - explosion_frame1-4 (16x16): Animación de explosión
- *
- * NOTA: Usa 0x0000 (negro) como color transparente
- */
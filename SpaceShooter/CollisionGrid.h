@@ -0,0 +1,60 @@
+#ifndef COLLISION_GRID_H
+#define COLLISION_GRID_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Uniform grid broadphase over a W x H field of CELL-sized cells, rebuilt
+// every tick. Each cell holds a bitmask of the items (up to 64, by index)
+// whose box overlaps it, so a query ORs the masks of the cells it covers:
+// every candidate comes out once and in index order, which keeps hit
+// resolution in the same order as a plain loop over the items.
+//
+// Boxes reaching outside the field are clamped into the border cells.
+//
+// Only <stdint.h> / <string.h>, so it also builds on a host.
+template <int W, int H, int CELL> class CollisionGrid {
+public:
+  static const int COLS = (W + CELL - 1) / CELL;
+  static const int ROWS = (H + CELL - 1) / CELL;
+  static const int MAX_ITEMS = 64;
+
+  CollisionGrid() { clear(); }
+
+  void clear() { memset(_cells, 0, sizeof(_cells)); }
+
+  // Box [x0, x1] x [y0, y1]; indices >= MAX_ITEMS are ignored
+  void add(int index, float x0, float y0, float x1, float y1) {
+    if (index < 0 || index >= MAX_ITEMS)
+      return;
+    uint64_t bit = (uint64_t)1 << index;
+    int c0 = col(x0), c1 = col(x1), r0 = row(y0), r1 = row(y1);
+    for (int r = r0; r <= r1; r++)
+      for (int c = c0; c <= c1; c++)
+        _cells[r][c] |= bit;
+  }
+
+  // Items whose cells overlap the box, as a bitmask (bit i = item i)
+  uint64_t query(float x0, float y0, float x1, float y1) const {
+    uint64_t mask = 0;
+    int c0 = col(x0), c1 = col(x1), r0 = row(y0), r1 = row(y1);
+    for (int r = r0; r <= r1; r++)
+      for (int c = c0; c <= c1; c++)
+        mask |= _cells[r][c];
+    return mask;
+  }
+
+private:
+  uint64_t _cells[ROWS][COLS];
+
+  static int col(float x) {
+    int c = (int)x / CELL;
+    return x < 0 ? 0 : (c < COLS ? c : COLS - 1);
+  }
+  static int row(float y) {
+    int r = (int)y / CELL;
+    return y < 0 ? 0 : (r < ROWS ? r : ROWS - 1);
+  }
+};
+
+#endif
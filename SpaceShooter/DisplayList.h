@@ -0,0 +1,110 @@
+#ifndef DISPLAY_LIST_H
+#define DISPLAY_LIST_H
+
+#include <Arduino.h>
+
+// One drawable resolved for the frame. What x, y, color and data mean is up
+// to the engine's draw routine for `kind`; top/bottom are the screen rows it
+// can touch and decide which bands it is binned into.
+struct DisplayItem {
+  uint8_t kind;
+  int16_t x, y;
+  int16_t top, bottom; // Rows [top, bottom)
+  uint16_t color;
+  const void *data;
+};
+
+// Per-frame list of drawables bucketed by band. Built once after update():
+// add() in draw order, then finish() bins every item into the bands it
+// overlaps, so each band only visits what intersects it.
+template <int MAX_ITEMS, int MAX_BANDS, int MAX_REFS = MAX_ITEMS * 3>
+class DisplayList {
+public:
+  DisplayList() : _count(0), _bandH(1), _bands(0), _dropped(0) {}
+
+  void begin(int bandHeight, int screenHeight) {
+    _count = 0;
+    _dropped = 0;
+    _bandH = bandHeight;
+    _bands = min((screenHeight + bandHeight - 1) / bandHeight, MAX_BANDS);
+  }
+
+  // Returns the slot to fill in, or nullptr if the item is off screen or
+  // the list is full
+  DisplayItem *add(uint8_t kind, int top, int bottom) {
+    if (bottom <= 0 || top >= _bands * _bandH)
+      return nullptr;
+    if (_count >= MAX_ITEMS) {
+      _dropped++;
+      return nullptr;
+    }
+    DisplayItem &item = _items[_count++];
+    item.kind = kind;
+    item.top = top;
+    item.bottom = bottom;
+    item.x = item.y = 0;
+    item.color = 0;
+    item.data = nullptr;
+    return &item;
+  }
+
+  // Counting sort of item references by band, keeping draw order
+  void finish() {
+    memset(_start, 0, sizeof(_start));
+    for (int i = 0; i < _count; i++)
+      for (int b = firstBand(_items[i]); b <= lastBand(_items[i]); b++)
+        _start[b + 1]++;
+    for (int b = 0; b < _bands; b++)
+      _start[b + 1] += _start[b];
+
+    uint16_t fill[MAX_BANDS];
+    memcpy(fill, _start, sizeof(fill));
+    for (int i = 0; i < _count; i++) {
+      for (int b = firstBand(_items[i]); b <= lastBand(_items[i]); b++) {
+        if (fill[b] < MAX_REFS)
+          _refs[fill[b]++] = i;
+        else
+          _dropped++;
+      }
+    }
+    for (int b = 0; b < _bands; b++)
+      _end[b] = fill[b];
+  }
+
+  // Calls draw(item) for the items overlapping rows [top, top + height).
+  // Band-aligned queries use the bins; anything else scans the list.
+  template <typename F> void forEach(int top, int height, F draw) const {
+    if (top % _bandH == 0 && height <= _bandH && top >= 0 &&
+        top / _bandH < _bands) {
+      int b = top / _bandH;
+      for (int r = _start[b]; r < _end[b]; r++)
+        draw(_items[_refs[r]]);
+      return;
+    }
+    for (int i = 0; i < _count; i++)
+      if (_items[i].top < top + height && _items[i].bottom > top)
+        draw(_items[i]);
+  }
+
+  int size() const { return _count; }
+  uint16_t dropped() const { return _dropped; }
+
+private:
+  DisplayItem _items[MAX_ITEMS];
+  uint16_t _refs[MAX_REFS];
+  uint16_t _start[MAX_BANDS + 1];
+  uint16_t _end[MAX_BANDS];
+  int _count;
+  int _bandH;
+  int _bands;
+  uint16_t _dropped;
+
+  int firstBand(const DisplayItem &item) const {
+    return max(0, (int)item.top / _bandH);
+  }
+  int lastBand(const DisplayItem &item) const {
+    return min(_bands - 1, (item.bottom - 1) / _bandH);
+  }
+};
+
+#endif
@@ -2,13 +2,27 @@
 #include "Assets.h"
 #include "System.h"
 
-Preferences preferences;
+SaveStore<ShooterSave, 1> save;
+
+// Coins, purchases and records reach flash this long after the last change,
+// once play has stopped
+#define SAVE_DELAY_MS 2000
 
 #define SCREEN_W 480
 #define SCREEN_H 320
 
-GameEngine::GameEngine(TFT_eSPI *tft, Input *input) : _tft(tft), _input(input) {
-  _canvas = new TFT_eSprite(tft);
+// Fixed-period timers count seconds. The margin absorbs float rounding, so
+// a period of a whole number of ticks fires on that tick.
+static bool timerDue(float &timer, float period) {
+  if (timer < period - 0.0001f)
+    return false;
+  timer -= period;
+  return true;
+}
+
+GameEngine::GameEngine(TFT_eSPI *tft, Input *input)
+    : _tft(tft), _input(input), _pipeline(tft) {
+  _canvas = nullptr;
   _state = STATE_MENU;
   _score = 0;
   _highScore = 0;
@@ -18,8 +32,13 @@ GameEngine::GameEngine(TFT_eSPI *tft, Input *input) : _tft(tft), _input(input) {
   _waveNumber = 0;
   _enemiesKilled = 0;
   _bossActive = false;
+  _gameTime = 0;
+  _waveCooldown = 0;
   _powerupTimer = 0;
+  _shootTimer = 0;
+  _touchShootTimer = 0;
   _weaponPowerupActive = false;
+  _weaponPowerupLeft = 0;
   _bossShootTimer = 0;
   _shopScroll = 0;
   _lastTouchX = 0;
@@ -30,19 +49,30 @@ GameEngine::GameEngine(TFT_eSPI *tft, Input *input) : _tft(tft), _input(input) {
   _selectedMenuItem = 0;
   _selectedShopItem = 0;
   _selectedPauseOption = 0;
-  _lastJoystickTime = 0;
-  _lastJoystickDir = -1;
   _showWaveText = false;
+  _waveText[0] = '\0';
   _waveTextTimer = 0;
 }
 
 void GameEngine::init() {
-  preferences.begin("spaceshooter", false);
+  initSimulation();
+  initRender();
+}
+
+void GameEngine::initSimulation() {
   loadGameData();
 
-  _canvas->setColorDepth(16);
-  void *ptr = _canvas->createSprite(SCREEN_W, 32);
-  if (!ptr) {
+  for (int i = 0; i < 50; i++) {
+    _stars.push_back({(float)random(SCREEN_W), (float)random(SCREEN_H),
+                      random(1, 4) * 60.0f, // px/s
+                      (uint16_t)(random(0, 2) ? C_WHIT : C_GREY)});
+  }
+}
+
+void GameEngine::initRender() {
+  // Stars and sprites move every frame but cover little of the screen, so
+  // only the changed spans of a PSRAM framebuffer are pushed
+  if (!_pipeline.begin(SCREEN_W, 32, SCREEN_H, RENDER_FRAMEBUFFER)) {
     Serial.println("Failed to create strip sprite!");
     _useSprite = false;
   } else {
@@ -50,35 +80,72 @@ void GameEngine::init() {
     _useSprite = true;
   }
 
-  for (int i = 0; i < 50; i++) {
-    _stars.push_back({(float)random(SCREEN_W), (float)random(SCREEN_H),
-                      (float)random(1, 4),
-                      (uint16_t)(random(0, 2) ? C_WHIT : C_GREY)});
-  }
+  for (int i = 0; i < _pipeline.bufferCount(); i++)
+    _pipeline.buffer(i)->setTextFont(2);
 
-  _canvas->setTextFont(2);
+  _hudScore.begin(_tft, 110, 16, 2, C_WHIT, TFT_BLACK);
+  _hudCoins.begin(_tft, 100, 16, 2, C_WHIT, TFT_BLACK);
+  _hudBoss.begin(_tft, 40, 16, 2, C_WHIT, TFT_BLACK);
+  _hudBoss.setText("BOSS");
+  _hudWave.begin(_tft, 200, 32, 2, C_YELL, TFT_BLACK, MC_DATUM, 2);
+
+  // Botón PAUSE (más grande)
+  if (_hudPause.begin(_tft, 60, 30, 2, TFT_BLACK, TFT_BLACK)) {
+    TFT_eSprite *button = _hudPause.sprite();
+    button->fillRoundRect(0, 0, 60, 30, 5, C_ORNG);
+    button->setTextColor(TFT_BLACK);
+    button->setTextDatum(MC_DATUM);
+    button->drawString("II", 30, 15, 2);
+  }
 }
 
 void GameEngine::loadGameData() {
-  _coins = preferences.getInt("coins", 0);
-  _highScore = preferences.getInt("highScore", 0);
-  _equippedSkin = preferences.getInt("equippedSkin", 0);
+  if (!save.begin("spaceshooter"))
+    migrateSave();
+  const ShooterSave &data = save.get();
+  _coins = data.coins;
+  _highScore = data.highScore;
+  _equippedSkin = data.equippedSkin;
 
   // Marcar skins compradas
-  for (int i = 0; i < NUM_SKINS; i++) {
-    shopSkins[i].purchased =
-        preferences.getBool(("skin_" + String(i)).c_str(), i == 0);
-  }
+  for (int i = 0; i < NUM_SKINS; i++)
+    shopSkins[i].purchased = data.ownedSkins & (1 << i);
 }
 
+// Only marks the record: it may run mid-tick (the boss kill), so the write
+// waits for the menus, see update()
 void GameEngine::saveGameData() {
-  preferences.putInt("coins", _coins);
-  preferences.putInt("highScore", _highScore);
-  preferences.putInt("equippedSkin", _equippedSkin);
+  ShooterSave data = {};
+  data.coins = _coins;
+  data.highScore = _highScore;
+  data.equippedSkin = _equippedSkin;
+  for (int i = 0; i < NUM_SKINS; i++)
+    data.ownedSkins |= shopSkins[i].purchased << i;
+  save.set(data);
+}
 
-  for (int i = 0; i < NUM_SKINS; i++) {
-    preferences.putBool(("skin_" + String(i)).c_str(), shopSkins[i].purchased);
-  }
+// Before the single record every value had its own key. Their values move
+// into the record and, once it is written, the keys are removed.
+void GameEngine::migrateSave() {
+  Preferences &old = save.prefs();
+  ShooterSave data = {};
+  data.coins = old.getInt("coins", 0);
+  data.highScore = old.getInt("highScore", 0);
+  data.equippedSkin = old.getInt("equippedSkin", 0);
+  for (int i = 0; i < NUM_SKINS; i++)
+    if (old.getBool(("skin_" + String(i)).c_str(), i == 0))
+      data.ownedSkins |= 1 << i;
+  save.set(data);
+  save.flush();
+  if (save.dirty())
+    return; // Keep the keys, try again next boot
+
+  Serial.println("Save migrated to a single record");
+  const char *keys[] = {"coins", "highScore", "equippedSkin"};
+  for (const char *key : keys)
+    old.remove(key);
+  for (int i = 0; i < NUM_SKINS; i++)
+    old.remove(("skin_" + String(i)).c_str());
 }
 
 void GameEngine::startGame() {
@@ -87,14 +154,19 @@ void GameEngine::startGame() {
   _waveNumber = 0;
   _enemiesKilled = 0;
   _bossActive = false;
+  _gameTime = 0;
+  _waveCooldown = 0;
+  _clearedAt = 0;
   _powerupTimer = 0;
+  scheduleNextPowerup();
   _weaponPowerupActive = false;
   _gameStartTime = millis();
   _player = {
       SCREEN_W / 2.0f, SCREEN_H - 50.0f, 0, 0, 32, 32, 0, true, 100, C_CYAN, 0};
   _enemies.clear();
   _bullets.clear();
-  _particles.clear();
+  _explosions.clear();
+  _sparks.clear();
   _powerups.clear();
 }
 
@@ -108,12 +180,27 @@ int GameEngine::getDifficultyLevel() {
   return 4;
 }
 
+// Enemies still flying: the ones shot down stay in the pool until the next
+// updateEnemies(), which must not hold up the next wave by a tick
+int GameEngine::enemiesLeft() {
+  int n = 0;
+  for (auto &e : _enemies)
+    n += e.active;
+  return n;
+}
+
 void GameEngine::update(float dt) {
+  PROFILE_SCOPE(PROF_UPDATE);
+  _input->poll();
   Point touch = _input->getTouch(SCREEN_W, SCREEN_H);
   JoystickInput joy = _input->getJoystick();
   ButtonInput btn = _input->getButtons();
+  InputDirection nav = _input->getNavigation();
   static unsigned long winTime = 0;
-  static unsigned long lastEnemySpawnTime = 0;
+
+  // Pending saves reach flash outside of play only
+  if (_state != STATE_PLAYING)
+    save.flushIfDue(SAVE_DELAY_MS);
 
   // SISTEMA ANTIRREBOTES - Evitar clicks accidentales
   unsigned long currentTime = millis();
@@ -145,26 +232,13 @@ void GameEngine::update(float dt) {
   }
 
   if (_state == STATE_SHOP) {
-    // Joystick navigation for shop - only trigger on direction change
-    if (joy.active && currentTime - _lastJoystickTime > 300) {
-      int currentDir = (int)joy.direction;
-      // Only change if direction is different from last time
-      if (currentDir != _lastJoystickDir) {
-        if (joy.direction == INPUT_DIR_LEFT) {
-          _selectedShopItem = (_selectedShopItem - 1 + NUM_SKINS) % NUM_SKINS;
-          _shopScroll = _selectedShopItem * 160;
-          _lastJoystickTime = currentTime;
-          _lastJoystickDir = currentDir;
-        } else if (joy.direction == INPUT_DIR_RIGHT) {
-          _selectedShopItem = (_selectedShopItem + 1) % NUM_SKINS;
-          _shopScroll = _selectedShopItem * 160;
-          _lastJoystickTime = currentTime;
-          _lastJoystickDir = currentDir;
-        }
-      }
-    } else if (!joy.active) {
-      // Reset direction when joystick is released
-      _lastJoystickDir = -1;
+    // Joystick navigation for shop
+    if (nav == INPUT_DIR_LEFT) {
+      _selectedShopItem = (_selectedShopItem - 1 + NUM_SKINS) % NUM_SKINS;
+      _shopScroll = _selectedShopItem * 160;
+    } else if (nav == INPUT_DIR_RIGHT) {
+      _selectedShopItem = (_selectedShopItem + 1) % NUM_SKINS;
+      _shopScroll = _selectedShopItem * 160;
     }
 
     // Button A to purchase/equip skin
@@ -239,15 +313,10 @@ void GameEngine::update(float dt) {
     }
   } else if (_state == STATE_MENU) {
     // Joystick navigation for menu
-    if (joy.active && currentTime - _lastJoystickTime > 200) {
-      if (joy.direction == INPUT_DIR_UP) {
-        _selectedMenuItem = (_selectedMenuItem - 1 + 3) % 3;
-        _lastJoystickTime = currentTime;
-      } else if (joy.direction == INPUT_DIR_DOWN) {
-        _selectedMenuItem = (_selectedMenuItem + 1) % 3;
-        _lastJoystickTime = currentTime;
-      }
-    }
+    if (nav == INPUT_DIR_UP)
+      _selectedMenuItem = (_selectedMenuItem - 1 + 3) % 3;
+    else if (nav == INPUT_DIR_DOWN)
+      _selectedMenuItem = (_selectedMenuItem + 1) % 3;
 
     // Button A to select menu item
     if (btn.aJustPressed && !_clickDebounce) {
@@ -281,6 +350,7 @@ void GameEngine::update(float dt) {
                touch.y > 20 && touch.y < 60) {
         _lastClickTime = currentTime;
         _clickDebounce = true;
+        save.flush();
         returnToMenu(); // Declared in System.h
       }
     }
@@ -295,26 +365,16 @@ void GameEngine::update(float dt) {
       return;
     }
 
+    _gameTime += dt;
+
+    float startX = _player.x, startY = _player.y;
+
     // Joystick control for player movement
     if (joy.active) {
       // Move player based on joystick input
-      float speed = 15.0f; // Increased speed for better responsiveness
-      _player.x += (joy.x / 2048.0f) * speed;
-      _player.y += (joy.y / 2048.0f) * speed;
-    }
-
-    // Button A to shoot
-    static int shootTimer = 0;
-    if (btn.aPressed) {
-      shootTimer++;
-      int fireRate = _weaponPowerupActive ? 1 : 2;
-      if (shootTimer > fireRate) {
-        _bullets.push_back(
-            {_player.x, _player.y - 16, 0, -15, 4, 8, 2, true, 1, C_YELL, 0});
-        shootTimer = 0;
-      }
-    } else {
-      shootTimer = 0;
+      float speed = 900.0f; // px/s at full tilt
+      _player.x += (joy.x / 2048.0f) * speed * dt;
+      _player.y += (joy.y / 2048.0f) * speed * dt;
     }
 
     // Control del jugador - VERSIÓN MÁS RÁPIDA (touch control)
@@ -322,70 +382,87 @@ void GameEngine::update(float dt) {
       float dx = touch.x - _player.x;
       float dy = (touch.y - 40) - _player.y;
 
-      // MOVIMIENTO MÁS RÁPIDO
-      _player.x += dx * 0.8f;
-      _player.y += dy * 0.8f;
-
-      static int touchShootTimer = 0;
-      touchShootTimer++;
-
-      // DISPARO MÁS RÁPIDO (1/2 en lugar de 2/4)
-      int fireRate = _weaponPowerupActive ? 1 : 2;
-      if (touchShootTimer > fireRate) {
-        // BALAS MÁS RÁPIDAS (vy = -15 en lugar de -8)
-        _bullets.push_back(
-            {_player.x, _player.y - 16, 0, -15, 4, 8, 2, true, 1, C_YELL, 0});
-        touchShootTimer = 0;
-      }
+      // MOVIMIENTO MÁS RÁPIDO: cubre el 80% de la distancia cada 1/60 s
+      float follow = 1 - powf(0.2f, dt * 60);
+      _player.x += dx * follow;
+      _player.y += dy * follow;
     }
 
     _player.x = constrain(_player.x, 16, SCREEN_W - 16);
     _player.y = constrain(_player.y, 16, SCREEN_H - 16);
+    // Average over the tick, to place shots and sweep contacts
+    _player.vx = (_player.x - startX) / dt;
+    _player.vy = (_player.y - startY) / dt;
+
+    // Power-ups before the shots, so a pickup during the tick already
+    // speeds up the ones due after it
+    if (_weaponPowerupActive)
+      _weaponPowerupLeft -= dt;
+    updatePowerups(dt);
+    collectPowerups(dt);
 
-    if (_weaponPowerupActive && millis() > _weaponPowerupEnd) {
-      _weaponPowerupActive = false;
+    // Button A to shoot
+    if (btn.aPressed) {
+      _shootTimer += dt;
+      fireDue(_shootTimer, dt);
+    } else {
+      _shootTimer = 0;
+    }
+    if (touch.touched) {
+      _touchShootTimer += dt;
+      fireDue(_touchShootTimer, dt);
     }
 
-    // AGREGAR ESTA LÓGICA PARA GENERAR ENEMIGOS
-    unsigned long currentTime = millis();
+    if (_weaponPowerupActive && _weaponPowerupLeft <= 0)
+      _weaponPowerupActive = false;
 
     // Generar nueva oleada si no hay enemigos y ha pasado el tiempo suficiente
-    if (_enemies.empty() && !_bossActive &&
-        currentTime - lastEnemySpawnTime > 3000) { // 3 segundos entre oleadas
-      spawnEnemyWave();
-      lastEnemySpawnTime = currentTime;
+    // (3 segundos desde la anterior)
+    // Due when the cooldown ran out or the last enemy went, whichever came
+    // later; seen a tick or two after that, so the wave is aged to match
+    _waveCooldown -= dt;
+    if (enemiesLeft() == 0 && !_bossActive && _waveCooldown <= 0) {
+      float late = min(-_waveCooldown, _gameTime - _clearedAt);
+      spawnEnemyWave(late - dt);
+      _waveCooldown = 3.0f - late;
     }
 
     updateEnemies(dt);
     updateBullets(dt);
     updateParticles(dt);
-    updatePowerups(dt);
     if (_bossActive)
       updateBoss(dt);
-    checkCollisions();
+    checkCollisions(dt);
+
+    if (_showWaveText) {
+      _waveTextTimer -= dt;
+      if (_waveTextTimer <= 0)
+        _showWaveText = false;
+    }
 
     // Spawn del boss (solo si no hay uno activo)
-    if (_score >= 2000 && !_bossActive && _enemies.size() == 0) {
-      _waveText = "FINAL BOSS";
+    if (_score >= 2000 && !_bossActive && enemiesLeft() == 0) {
+      snprintf(_waveText, sizeof(_waveText), "FINAL BOSS");
       _showWaveText = true;
-      _waveTextTimer = 180;
+      _waveTextTimer = 3.0f;
       spawnBoss();
     }
 
     // CONDICIÓN DE VICTORIA
-    if (_bossActive && !_boss.active && _enemies.size() == 0) {
+    if (_bossActive && !_boss.active && enemiesLeft() == 0) {
       _state = STATE_WIN;
       winTime = millis(); // Guardar tiempo de victoria
       _coins += _score / 10 + 500;
       if (_score > _highScore)
         _highScore = _score;
       saveGameData();
+      printPoolUsage();
     }
 
-    _powerupTimer++;
-    if (_powerupTimer > random(600, 900)) {
-      spawnPowerup();
-      _powerupTimer = 0;
+    _powerupTimer -= dt;
+    if (_powerupTimer <= 0) {
+      spawnPowerup(-_powerupTimer);
+      scheduleNextPowerup();
     }
 
     // Game Over - AHORA DA MONEDAS AL PERDER TAMBIÉN
@@ -396,18 +473,24 @@ void GameEngine::update(float dt) {
       _coins += _score / 20; // Monedas al perder = 5% del score
       _state = STATE_GAMEOVER;
       saveGameData();
+      printPoolUsage();
+    }
+
+    // Actualizar estrellas de fondo (solo en juego, para que las pantallas
+    // estaticas no tengan que redibujarse).
+    // Wrapped by subtraction and without random(): the starfield and the
+    // game's random sequence are the same at any tick rate.
+    for (auto &s : _stars) {
+      s.y += s.speed * dt;
+      if (s.y >= SCREEN_H)
+        s.y -= SCREEN_H;
     }
   } else if (_state == STATE_PAUSED) {
     // Joystick navigation for pause menu
-    if (joy.active && currentTime - _lastJoystickTime > 200) {
-      if (joy.direction == INPUT_DIR_UP) {
-        _selectedPauseOption = (_selectedPauseOption - 1 + 2) % 2;
-        _lastJoystickTime = currentTime;
-      } else if (joy.direction == INPUT_DIR_DOWN) {
-        _selectedPauseOption = (_selectedPauseOption + 1) % 2;
-        _lastJoystickTime = currentTime;
-      }
-    }
+    if (nav == INPUT_DIR_UP)
+      _selectedPauseOption = (_selectedPauseOption - 1 + 2) % 2;
+    else if (nav == INPUT_DIR_DOWN)
+      _selectedPauseOption = (_selectedPauseOption + 1) % 2;
 
     // Button A to select pause menu option
     if (btn.aJustPressed && !_clickDebounce) {
@@ -459,14 +542,6 @@ void GameEngine::update(float dt) {
       }
     }
   }
-  // Actualizar estrellas de fondo
-  for (auto &s : _stars) {
-    s.y += s.speed;
-    if (s.y >= SCREEN_H) {
-      s.y = 0;
-      s.x = random(SCREEN_W);
-    }
-  }
 }
 
 void GameEngine::purchaseSkin(int skinId) {
@@ -492,23 +567,27 @@ void GameEngine::returnToMainMenu() {
   saveGameData();
 }
 
-void GameEngine::spawnEnemyWave() {
+// `age`: seconds the wave has been on its way (as in spawnBullet)
+void GameEngine::spawnEnemyWave(float age) {
   _waveNumber++;
-  _waveText = "WAVE " + String(_waveNumber);
+  snprintf(_waveText, sizeof(_waveText), "WAVE %d", _waveNumber);
   _showWaveText = true;
-  _waveTextTimer = 120; // 2 seconds
+  _waveTextTimer = 2.0f;
 
   int pattern = random(0, 3);
-  spawnFormation(pattern);
+  spawnFormation(pattern, age);
 }
 
-void GameEngine::spawnFormation(int type) {
+void GameEngine::spawnFormation(int type, float age) {
   int difficulty = getDifficultyLevel();
   int enemyCount = 3 + difficulty;
   int enemyHealth = difficulty;
 
   for (int i = 0; i < enemyCount; i++) {
-    Entity e;
+    Entity *slot = _enemies.spawn();
+    if (!slot)
+      break;
+    Entity &e = *slot;
     e.type = 1;
     e.active = true;
     e.health = enemyHealth;
@@ -540,147 +619,234 @@ void GameEngine::spawnFormation(int type) {
       break;
     }
 
-    _enemies.push_back(e);
+    // The entrance ease (see updateEnemies) run for `age`
+    float left = powf(0.95f, age * 60);
+    e.x = e.targetX - (e.targetX - e.x) * left;
+    e.y = e.targetY - (e.targetY - e.y) * left;
   }
 }
 
-void GameEngine::spawnPowerup() {
-  Entity p;
+// `age`: seconds since it was due, already fallen
+void GameEngine::spawnPowerup(float age) {
+  Entity *slot = _powerups.spawn();
+  if (!slot)
+    return;
+  Entity &p = *slot;
   p.type = 4;
   p.x = random(50, SCREEN_W - 50);
   p.y = -20;
   p.vx = 0;
-  p.vy = 2;
+  p.vy = 120; // px/s
+  p.y += p.vy * age;
   p.width = 16;
   p.height = 16;
   p.active = true;
   p.health = random(0, 2);
   p.color = p.health == 0 ? C_BLUE : C_ORNG;
   p.animFrame = 0;
-  _powerups.push_back(p);
 }
 
 void GameEngine::spawnBoss() {
   _bossActive = true;
   _bossShootTimer = 0;
-  _boss = {SCREEN_W / 2.0f, 60.0f, 1.5f, 0, 48, 48, 5, true, 100, C_RED, 0};
+  _boss = {SCREEN_W / 2.0f, 60.0f, 90.0f, 0, 48, 48, 5, true, 100, C_RED, 0};
+}
+
+// Every 10 to 15 s of play, counted from when the last one was due
+void GameEngine::scheduleNextPowerup() {
+  _powerupTimer += random(10000, 15001) / 1000.0f;
 }
 
 void GameEngine::updateEnemies(float dt) {
+  // Entrance: 5% of the way to the slot every 1/60 s
+  float ease = 1 - powf(0.95f, dt * 60);
   for (auto &e : _enemies) {
+    float startX = e.x, startY = e.y;
     if (e.state == 0) { // ENTRANCE
+      e.x += (e.targetX - e.x) * ease;
+      e.y += (e.targetY - e.y) * ease;
+
+      // Within 2 px of the slot: attacks from the moment it got there,
+      // `over` seconds ago
       float dx = e.targetX - e.x;
       float dy = e.targetY - e.y;
-      e.x += dx * 0.05f;
-      e.y += dy * 0.05f;
-
-      if (abs(dx) < 2 && abs(dy) < 2) {
+      float near = max(abs(dx), abs(dy));
+      if (near < 2) {
+        float over = min(dt, logf(near / 2) / (60 * logf(0.95f)));
+        float back = powf(0.95f, -over * 60);
+        e.x = e.targetX - dx * back;
+        e.y = e.targetY - dy * back;
         e.state = 1; // ATTACK
+        attackMove(e, _gameTime - over, over);
       }
-    } else {       // ATTACK
-      e.y += 1.5f; // Constant speed down
-      e.x += sin(millis() / 200.0 + e.y * 0.05) * 2.0;
+    } else { // ATTACK
+      attackMove(e, _gameTime - dt, dt);
     }
+    e.vx = (e.x - startX) / dt; // For the swept contacts
+    e.vy = (e.y - startY) / dt;
 
-    if (e.y > SCREEN_H + 20)
+    if (e.y > SCREEN_H + 20 && e.active) {
       e.active = false;
+      _clearedAt = _gameTime - (e.y - (SCREEN_H + 20)) / 90.0f;
+    }
   }
 
   // Limpiar enemigos inactivos
   for (int i = _enemies.size() - 1; i >= 0; i--) {
     if (!_enemies[i].active) {
-      _enemies.erase(_enemies.begin() + i);
+      _enemies.remove(i);
       _enemiesKilled++;
     }
   }
 }
 
+// Attack from time t for dt: down at 90 px/s, weaving sideways at
+// 120 * sin(5 t + 0.05 y) px/s. As y grows with t the phase turns at
+// 9.5 rad/s, so the weave integrates exactly and the path is the same at
+// any tick rate.
+void GameEngine::attackMove(Entity &e, float t, float dt) {
+  float phase = t * 5.0f + e.y * 0.05f;
+  e.y += 90.0f * dt;
+  e.x += 120.0f / 9.5f * (cosf(phase) - cosf(phase + 9.5f * dt));
+}
+
 void GameEngine::updateBoss(float dt) {
   if (!_boss.active)
     return;
 
-  _boss.x += _boss.vx;
+  // Bounces off x = 50 and SCREEN_W - 50 where it crosses them
+  _boss.x += _boss.vx * dt;
   if (_boss.x < 50 || _boss.x > SCREEN_W - 50) {
+    float wall = _boss.x < 50 ? 50 : SCREEN_W - 50;
+    _boss.x = 2 * wall - _boss.x;
     _boss.vx = -_boss.vx;
   }
 
-  _bossShootTimer++;
-  if (_bossShootTimer > 120) {
+  _bossShootTimer += dt;
+  if (timerDue(_bossShootTimer, 2.0f)) {
     for (int i = -1; i <= 1; i++) {
-      _bullets.push_back(
-          {_player.x, _player.y - 16, 0, -20, 4, 8, 2, true, 1, C_YELL, 0});
+      spawnBullet(_player.x, _player.y - 16, -1200);
     }
-    _bossShootTimer = 0;
   }
 }
 
 void GameEngine::updateBullets(float dt) {
   for (auto &b : _bullets) {
-    b.y += b.vy;
-    b.x += b.vx;
-    if (b.y < -10 || b.y > SCREEN_H + 10 || b.x < 0 || b.x > SCREEN_W)
-      b.active = false;
+    b.y += b.vy * dt;
+    b.x += b.vx * dt;
+    b.age += dt;
   }
   for (int i = _bullets.size() - 1; i >= 0; i--) {
     if (!_bullets[i].active)
-      _bullets.erase(_bullets.begin() + i);
+      _bullets.remove(i);
   }
 }
 
 void GameEngine::updateParticles(float dt) {
-  for (auto &p : _particles) {
-    p.x += p.vx;
-    p.y += p.vy;
-    p.health--;
-    if (p.type == 3) {
-      p.animFrame = (28 - p.health) / 7;
-    }
-    if (p.health <= 0)
-      p.active = false;
-  }
-  for (int i = _particles.size() - 1; i >= 0; i--) {
-    if (!_particles[i].active)
-      _particles.erase(_particles.begin() + i);
-  }
+  _explosions.update(dt);
+  _sparks.update(dt);
 }
 
 void GameEngine::updatePowerups(float dt) {
   for (auto &p : _powerups) {
-    p.y += p.vy;
+    p.y += p.vy * dt;
     if (p.y > SCREEN_H + 20)
       p.active = false;
   }
   for (int i = _powerups.size() - 1; i >= 0; i--) {
     if (!_powerups[i].active)
-      _powerups.erase(_powerups.begin() + i);
+      _powerups.remove(i);
   }
 }
 
-void GameEngine::checkCollisions() {
+// One axis of a segment vs box test: narrows [t0, t1] to the part of the
+// motion (p + d * t) strictly inside (-h, h)
+static bool sweepAxis(float p, float d, float h, float &t0, float &t1) {
+  if (d == 0)
+    return p > -h && p < h;
+  float a = (-h - p) / d;
+  float b = (h - p) / d;
+  if (a > b) {
+    float t = a;
+    a = b;
+    b = t;
+  }
+  t0 = max(t0, a);
+  t1 = min(t1, b);
+  return t0 < t1;
+}
+
+// True if a and b, moving at their vx/vy, overlapped anywhere in the last
+// `dt` seconds, so fast bullets can't step over a target between two ticks
+// and contacts count from when they started, whatever the tick rate.
+// `before`: how long before the end they first touched.
+static bool sweptHits(const Entity &a, const Entity &b, float dt,
+                      float &before) {
+  float t0 = 0, t1 = 1;
+  float dx = (a.vx - b.vx) * dt;
+  float dy = (a.vy - b.vy) * dt;
+  if (!sweepAxis(a.x - dx - b.x, dx, a.width / 2 + b.width / 2, t0, t1) ||
+      !sweepAxis(a.y - dy - b.y, dy, a.height / 2 + b.height / 2, t0, t1))
+    return false;
+  before = (1 - t0) * dt;
+  return true;
+}
+
+void GameEngine::checkCollisions(float dt) {
+  // Player bullets only test the enemies sharing a grid cell with their
+  // swept box; candidates come in enemy order, as in a plain loop. Enemies
+  // are filed under their own swept box for the tick.
+  _enemyGrid.clear();
+  for (int i = 0; i < _enemies.size(); i++) {
+    const Entity &e = _enemies[i];
+    if (!e.active)
+      continue;
+    float prevX = e.x - e.vx * dt;
+    float prevY = e.y - e.vy * dt;
+    _enemyGrid.add(i, min(e.x, prevX) - e.width / 2,
+                   min(e.y, prevY) - e.height / 2,
+                   max(e.x, prevX) + e.width / 2,
+                   max(e.y, prevY) + e.height / 2);
+  }
+
   for (auto &b : _bullets) {
     if (!b.active || b.vy > 0)
       continue;
 
-    for (auto &e : _enemies) {
+    // This tick's move, from the muzzle if fired during it, and how long it
+    // has been off the top of the screen: it only hits before that
+    float flown = min(dt, b.age);
+    float gone = max(0.0f, (b.y + 10) / b.vy);
+    float prevX = b.x - b.vx * flown;
+    float prevY = b.y - b.vy * flown;
+    uint64_t candidates = _enemyGrid.query(
+        min(b.x, prevX) - b.width / 2, min(b.y, prevY) - b.height / 2,
+        max(b.x, prevX) + b.width / 2, max(b.y, prevY) + b.height / 2);
+    while (candidates) {
+      Entity &e = _enemies[__builtin_ctzll(candidates)];
+      candidates &= candidates - 1;
       if (!e.active)
         continue;
-      if (abs(b.x - e.x) < (e.width / 2 + b.width / 2) &&
-          abs(b.y - e.y) < (e.height / 2 + b.height / 2)) {
+      float before;
+      if (sweptHits(b, e, flown, before) && before >= gone) {
         b.active = false;
         e.health--;
         if (e.health <= 0) {
           e.active = false;
+          _clearedAt = _gameTime - before;
           createExplosion(e.x, e.y, C_ORNG);
+          emitSparks(e.x, e.y, 24, 240.0f);
           _score += 100;
         }
       }
     }
 
     if (_bossActive && _boss.active) {
-      if (abs(b.x - _boss.x) < (_boss.width / 2 + b.width / 2) &&
-          abs(b.y - _boss.y) < (_boss.height / 2 + b.height / 2)) {
+      float before;
+      if (sweptHits(b, _boss, flown, before) && before >= gone) {
         b.active = false;
         _boss.health--;
+        emitSparks(b.x, b.y, 6, 180.0f);
         if (_boss.health <= 0) {
           _boss.active = false;
           _bossActive = false; // Asegurar que el boss está inactivo
@@ -692,6 +858,7 @@ void GameEngine::checkCollisions() {
           if (_score > _highScore)
             _highScore = _score;
           saveGameData();
+          printPoolUsage();
         }
       }
     }
@@ -708,29 +875,40 @@ void GameEngine::checkCollisions() {
     }
   }
 
+  // Off screen only now, after the bullet's last stretch was tested
+  for (auto &b : _bullets) {
+    if (b.y < -10 || b.y > SCREEN_H + 10 || b.x < 0 || b.x > SCREEN_W)
+      b.active = false;
+  }
+
   for (auto &e : _enemies) {
     if (!e.active)
       continue;
-    if (abs(e.x - _player.x) < (e.width / 2 + _player.width / 2) &&
-        abs(e.y - _player.y) < (e.height / 2 + _player.height / 2)) {
+    float before;
+    if (sweptHits(e, _player, dt, before)) {
       e.active = false;
+      _clearedAt = _gameTime - before;
       _player.health -= 20;
       createExplosion(e.x, e.y, C_RED);
       createExplosion(_player.x, _player.y, C_RED);
     }
   }
+}
 
+// Touching a power-up: +50 health, or the faster gun for 10 s from the
+// moment of the pickup
+void GameEngine::collectPowerups(float dt) {
   for (auto &p : _powerups) {
     if (!p.active)
       continue;
-    if (abs(p.x - _player.x) < (p.width / 2 + _player.width / 2) &&
-        abs(p.y - _player.y) < (p.height / 2 + _player.height / 2)) {
+    float before;
+    if (sweptHits(p, _player, dt, before)) {
       p.active = false;
       if (p.health == 0) {
         _player.health = min(100, _player.health + 50);
       } else {
         _weaponPowerupActive = true;
-        _weaponPowerupEnd = millis() + 10000;
+        _weaponPowerupLeft = 10.0f - before;
       }
     }
   }
@@ -738,277 +916,253 @@ void GameEngine::checkCollisions() {
 
 void GameEngine::spawnEnemy() {}
 
+// The explosion sprite animates on its own; color is not used by it
 void GameEngine::createExplosion(float x, float y, uint16_t color) {
-  Entity p;
-  p.x = x;
-  p.y = y;
-  p.vx = 0;
-  p.vy = 0;
-  p.health = 28;
-  p.color = color;
-  p.active = true;
-  p.type = 3;
-  p.animFrame = 0;
-  p.width = 16;
-  p.height = 16;
-  _particles.push_back(p);
+  _explosions.spawn(x, y, 0, 0);
 }
 
-void GameEngine::draw() {
-  if (!_useSprite) {
-    _tft->fillScreen(TFT_BLACK);
-    return;
+// Sparks fly out in random directions at up to `speed` px/s. The random
+// numbers are drawn even when the pool is full, so the game's random
+// sequence does not depend on how many sparks are still alive.
+void GameEngine::emitSparks(float x, float y, int count, float speed) {
+  for (int i = 0; i < count; i++) {
+    float angle = random(628) / 100.0f;
+    float v = speed * random(30, 101) / 100.0f;
+    _sparks.spawn(x, y, cosf(angle) * v, sinf(angle) * v);
   }
+}
 
-  for (int y = 0; y < SCREEN_H; y += 32) {
-    _canvas->fillSprite(TFT_BLACK);
-
-    for (auto &s : _stars) {
-      int localY = (int)s.y - y;
-      if (localY >= 0 && localY < 32)
-        _canvas->drawPixel((int)s.x, localY, s.color);
-    }
-
-    if (_state == STATE_MENU) {
-      drawMenu(y);
-    } else if (_state == STATE_SHOP) {
-      drawShop(y);
-    } else if (_state == STATE_PLAYING) {
-      drawPlayer(y);
-      for (auto &e : _enemies)
-        drawEnemy(e, y);
-      for (auto &b : _bullets)
-        drawBullet(b, y);
-      for (auto &p : _powerups)
-        drawPowerup(p, y);
-      if (_bossActive && _boss.active)
-        drawBoss(y);
-      for (auto &p : _particles)
-        drawExplosion(p, y);
-      drawHUD(y);
-    } else if (_state == STATE_PAUSED) {
-      drawPlayer(y);
-      for (auto &e : _enemies)
-        drawEnemy(e, y);
-      for (auto &b : _bullets)
-        drawBullet(b, y);
-      for (auto &p : _powerups)
-        drawPowerup(p, y);
-      if (_bossActive && _boss.active)
-        drawBoss(y);
-      for (auto &p : _particles)
-        drawExplosion(p, y);
-      drawPauseMenu(y);
-    } else if (_state == STATE_GAMEOVER) {
-      drawGameOver(y);
-    } else if (_state == STATE_WIN) {
-      drawWinScreen(y);
-    }
-
-    _canvas->pushSprite(0, y);
+// `age` seconds of flight already behind it (negative: still to come
+// before updateBullets() moves it this tick)
+void GameEngine::spawnBullet(float x, float y, float vy, float age) {
+  Entity *b = _bullets.spawn();
+  if (b) {
+    *b = {x, y + vy * age, 0, vy, 4, 8, 2, true, 1, C_YELL, 0};
+    b->age = age;
   }
 }
 
-void GameEngine::drawPlayer(int offsetY) {
-  int localY = (int)_player.y - offsetY;
-  if (localY < -20 || localY > 52)
-    return;
-
-  int startX = (int)_player.x - PLAYER_W / 2;
-  int startY = localY - PLAYER_H / 2;
-
-  // Usar la skin equipada
-  const uint16_t *skin = player_skins[_equippedSkin];
-
-  for (int y = 0; y < PLAYER_H; y++) {
-    int screenY = startY + y;
-    if (screenY < 0 || screenY >= 32)
-      continue;
-
-    for (int x = 0; x < PLAYER_W; x++) {
-      uint16_t color = pgm_read_word(&skin[y * PLAYER_W + x]);
-      if (color != C_TRSP) {
-        _canvas->drawPixel(startX + x, screenY, color);
-      }
-    }
+// Fires every shot that fell due during this tick, as the timer counts
+// them, from where the ship was at that moment and already flown for the
+// rest of the tick. The stream of bullets is then the same at any tick
+// rate.
+void GameEngine::fireDue(float &timer, float dt) {
+  // Disparo: 20 balas/s, 30 con el power-up (periodos de 3 y 2 ticks a
+  // 60 Hz). _weaponPowerupLeft is what is left of it at the end of the
+  // tick (negative: ran out that long ago), so it speeds up exactly the
+  // shots due between its pickup and its end.
+  for (;;) {
+    float fast = timer - 2 / 60.0f; // Seconds since the shot was due
+    float slow = timer - 3 / 60.0f;
+    float since = 10.0f - _weaponPowerupLeft; // Since the pickup
+    bool powered = _weaponPowerupActive && fast > -_weaponPowerupLeft;
+    float late = powered ? fast : slow;
+    if (powered && fast > since) // Due before the pickup: fires on it,
+      late = max(slow, since);   // unless the slow shot came first
+    // The margin absorbs float rounding, as in timerDue()
+    if (late < -0.0001f)
+      break;
+    timer = late;
+    late = max(0.0f, late);
+    float x = constrain(_player.x - _player.vx * late, 16, SCREEN_W - 16);
+    float y = constrain(_player.y - _player.vy * late, 16, SCREEN_H - 16);
+    spawnBullet(x, y - 16, -900, late - dt);
   }
 }
 
-void GameEngine::drawEnemy(Entity &e, int offsetY) {
-  int localY = (int)e.y - offsetY;
-  if (localY < -15 || localY > 47)
-    return;
-
-  int startX = (int)e.x - ENEMY_W / 2;
-  int startY = localY - ENEMY_H / 2;
-
-  for (int y = 0; y < ENEMY_H; y++) {
-    int screenY = startY + y;
-    if (screenY < 0 || screenY >= 32)
-      continue;
-
-    for (int x = 0; x < ENEMY_W; x++) {
-      uint16_t color = pgm_read_word(&enemy_ship[y * ENEMY_W + x]);
-      if (color != C_TRSP) {
-        _canvas->drawPixel(startX + x, screenY, color);
-      }
-    }
-  }
+// Peak pool use since boot, to tune the capacities in GameEngine.h
+void GameEngine::printPoolUsage() {
+  Serial.printf("Pools: enemies %d/%d, bullets %d/%d, powerups %d/%d, "
+                "explosions %d/%d, sparks %d/%d\n",
+                _enemies.highWater(), _enemies.capacity(),
+                _bullets.highWater(), _bullets.capacity(),
+                _powerups.highWater(), _powerups.capacity(),
+                _explosions.highWater(), _explosions.capacity(),
+                _sparks.highWater(), _sparks.capacity());
+  Serial.printf("Pools: dropped %u enemies, %u bullets, %u powerups, "
+                "%u explosions, %u sparks\n",
+                _enemies.dropped(), _bullets.dropped(), _powerups.dropped(),
+                _explosions.dropped(), _sparks.dropped());
 }
 
-void GameEngine::drawBoss(int offsetY) {
-  int localY = (int)_boss.y - offsetY;
-  if (localY < -30 || localY > 62)
+// The latest tick is drawn as is: at TICK_HZ it is at most 8 ms old
+void GameEngine::draw(float alpha) {
+  PROFILE_SCOPE(PROF_FRAME);
+  if (!_useSprite) {
+    _tft->fillScreen(TFT_BLACK);
     return;
+  }
 
-  int startX = (int)_boss.x - BOSS_W / 2;
-  int startY = localY - BOSS_H / 2;
+  if (_state != STATE_PLAYING && _pipeline.unchanged(viewKey()))
+    return; // Static screen, already on display
 
-  for (int y = 0; y < BOSS_H; y++) {
-    int screenY = startY + y;
-    if (screenY < 0 || screenY >= 32)
-      continue;
+  buildDisplayList();
+  if (_state == STATE_PLAYING) {
+    _hudScore.setValue("SCORE: %d", _score);
+    _hudCoins.setValue("COINS: %d", _coins);
+    if (_showWaveText)
+      _hudWave.setText(_waveText);
+  }
 
-    for (int x = 0; x < BOSS_W; x++) {
-      uint16_t color = pgm_read_word(&boss_ship[y * BOSS_W + x]);
-      if (color != C_TRSP) {
-        _canvas->drawPixel(startX + x, screenY, color);
+  int stripH = _pipeline.stripHeight();
+  _pipeline.beginFrame();
+  for (int stripY = 0; stripY < SCREEN_H; stripY += stripH) {
+    _canvas = _pipeline.beginStrip();
+    for (int row = 0; row < stripH; row += 32) {
+      int y = stripY + row;
+      _pipeline.selectBand(row);
+      _canvas->fillSprite(TFT_BLACK);
+      drawDisplayList(y);
+
+      if (_state == STATE_MENU) {
+        drawMenu(y);
+      } else if (_state == STATE_SHOP) {
+        drawShop(y);
+      } else if (_state == STATE_PLAYING) {
+        drawHUD(y);
+      } else if (_state == STATE_PAUSED) {
+        drawPauseMenu(y);
+      } else if (_state == STATE_GAMEOVER) {
+        drawGameOver(y);
+      } else if (_state == STATE_WIN) {
+        drawWinScreen(y);
       }
     }
+    _pipeline.pushStrip(stripY);
   }
+  _pipeline.endFrame();
 }
 
-void GameEngine::drawBullet(Entity &b, int offsetY) {
-  int localY = (int)b.y - offsetY;
-  if (localY < -10 || localY > 42)
-    return;
-
-  int startX = (int)b.x - BULLET_W / 2;
-  int startY = localY - BULLET_H / 2;
-
-  for (int y = 0; y < BULLET_H; y++) {
-    int screenY = startY + y;
-    if (screenY < 0 || screenY >= 32)
-      continue;
-
-    for (int x = 0; x < BULLET_W; x++) {
-      uint16_t color = pgm_read_word(&bullet_sprite[y * BULLET_W + x]);
-      if (color != C_TRSP) {
-        _canvas->drawPixel(startX + x, screenY, color);
-      }
-    }
+// What the menus and other static screens are drawn from (the stars stand
+// still outside gameplay); while it stays the same draw() neither renders
+// nor pushes anything
+ViewKey GameEngine::viewKey() const {
+  ViewKey key;
+  key.mix(_state);
+  switch (_state) {
+  case STATE_MENU:
+    key.mix(_selectedMenuItem).mix(_coins).mix(_highScore);
+    key.mix(_equippedSkin).mix((millis() / 100) % 20 > 10); // Title glow
+    break;
+  case STATE_SHOP: {
+    uint32_t purchased = 0;
+    for (int i = 0; i < NUM_SKINS; i++)
+      purchased |= shopSkins[i].purchased << i;
+    key.mix(_selectedShopItem).mix(_shopScroll).mix(_coins);
+    key.mix(_equippedSkin).mix(purchased);
+    break;
   }
+  case STATE_PAUSED:
+    key.mix(_selectedPauseOption);
+    break;
+  case STATE_GAMEOVER:
+  case STATE_WIN:
+    key.mix(_score).mix(_highScore).mix(_coins).mix((millis() / 500) % 2);
+    break;
+  default:
+    break;
+  }
+  return key;
 }
 
-void GameEngine::drawPowerup(Entity &p, int offsetY) {
-  int localY = (int)p.y - offsetY;
-  if (localY < -10 || localY > 42)
-    return;
-
-  int startX = (int)p.x - POWERUP_W / 2;
-  int startY = localY - POWERUP_H / 2;
-
-  const uint16_t *sprite = (p.health == 0) ? powerup_shield : powerup_weapon;
-
-  for (int y = 0; y < POWERUP_H; y++) {
-    int screenY = startY + y;
-    if (screenY < 0 || screenY >= 32)
-      continue;
+// Resolves everything that moves into screen rects once per frame, in draw
+// order: stars, player, enemies, bullets, power-ups, boss, explosions
+void GameEngine::buildDisplayList() {
+  _displayList.begin(32, SCREEN_H);
 
-    for (int x = 0; x < POWERUP_W; x++) {
-      uint16_t color = pgm_read_word(&sprite[y * POWERUP_W + x]);
-      if (color != C_TRSP) {
-        _canvas->drawPixel(startX + x, screenY, color);
-      }
+  for (auto &s : _stars) {
+    DisplayItem *item = _displayList.add(DL_STAR, (int)s.y, (int)s.y + 1);
+    if (item) {
+      item->x = (int)s.x;
+      item->y = (int)s.y;
+      item->color = s.color;
     }
   }
-}
 
-void GameEngine::drawExplosion(Entity &p, int offsetY) {
-  int localY = (int)p.y - offsetY;
-  if (localY < -10 || localY > 42)
-    return;
+  if (_state == STATE_PLAYING || _state == STATE_PAUSED) {
+    // Usar la skin equipada
+    addSprite(*player_skins[_equippedSkin], _player.x, _player.y);
+    for (auto &e : _enemies)
+      addSprite(enemy_ship, e.x, e.y);
+    for (auto &b : _bullets)
+      addSprite(bullet_sprite, b.x, b.y);
+    for (auto &p : _powerups)
+      addSprite(p.health == 0 ? powerup_shield : powerup_weapon, p.x, p.y);
+    if (_bossActive && _boss.active)
+      addSprite(boss_ship, _boss.x, _boss.y);
+    // Explosions batched by animation frame
+    for (int f = 0; f < 4; f++)
+      _explosions.forEach(f, [&](float x, float y) {
+        addSprite(explosion[f], x, y);
+      });
+  }
 
-  int startX = (int)p.x - 8;
-  int startY = localY - 8;
+  _displayList.finish();
+}
 
-  const uint16_t *frame;
-  switch (p.animFrame) {
-  case 0:
-    frame = explosion_frame1;
-    break;
-  case 1:
-    frame = explosion_frame2;
-    break;
-  case 2:
-    frame = explosion_frame3;
-    break;
-  default:
-    frame = explosion_frame4;
-    break;
+void GameEngine::addSprite(const RunSprite &sprite, float centerX,
+                           float centerY) {
+  int x = (int)centerX - sprite.w / 2;
+  int y = (int)centerY - sprite.h / 2;
+  DisplayItem *item =
+      _displayList.add(DL_SPRITE, y + sprite.oy, y + sprite.oy + sprite.bh);
+  if (item) {
+    item->x = x;
+    item->y = y;
+    item->data = &sprite;
   }
+}
 
-  for (int y = 0; y < 16; y++) {
-    int screenY = startY + y;
-    if (screenY < 0 || screenY >= 32)
-      continue;
+void GameEngine::drawDisplayList(int offsetY) {
+  _displayList.forEach(offsetY, 32, [&](const DisplayItem &item) {
+    if (item.kind == DL_STAR)
+      _canvas->drawPixel(item.x, item.y - offsetY, item.color);
+    else
+      drawRunSprite(_canvas, *(const RunSprite *)item.data, item.x,
+                    item.y - offsetY);
+  });
+  if (_state == STATE_PLAYING || _state == STATE_PAUSED)
+    drawSparks(offsetY);
+}
 
-    for (int x = 0; x < 16; x++) {
-      uint16_t color = pgm_read_word(&frame[y * 16 + x]);
-      if (color != C_TRSP) {
-        _canvas->drawPixel(startX + x, screenY, color);
-      }
-    }
+// Sparks go over everything as 2x2 dots, one colour per animation frame,
+// fading from white to red. Too many to put in the display list, so each
+// band scans them directly.
+void GameEngine::drawSparks(int offsetY) {
+  static const uint16_t colors[4] = {C_WHIT, C_YELL, C_ORNG, C_RED};
+  for (int f = 0; f < 4; f++) {
+    uint16_t color = colors[f];
+    _sparks.forEach(f, [&](float x, float y) {
+      int sy = (int)y - offsetY;
+      if (sy >= -1 && sy < 32)
+        _canvas->fillRect((int)x, sy, 2, 2, color);
+    });
   }
 }
 
 void GameEngine::drawHUD(int offsetY) {
+  // Text and the pause button are pre-rendered bitmaps, clipped to the band
+  if (_showWaveText)
+    _hudWave.draw(_canvas, SCREEN_W / 2 - 100, SCREEN_H / 2 - 16 - offsetY);
+
   if (offsetY > 40)
     return;
 
-  _canvas->setTextFont(2);
-  _canvas->setTextColor(C_WHIT);
-  _canvas->setTextSize(1);
-
   // Score y monedas
-  _canvas->setCursor(10, 10 - offsetY);
-  _canvas->printf("SCORE: %d", _score);
-
-  _canvas->setCursor(SCREEN_W - 400, 10 - offsetY);
-  _canvas->printf("COINS: %d", _coins);
+  _hudScore.draw(_canvas, 10, 10 - offsetY);
+  _hudCoins.draw(_canvas, 120, 10 - offsetY);
 
   // Barra de vida
   _canvas->drawRect(10, 25 - offsetY, 102, 12, C_WHIT);
   _canvas->fillRect(11, 26 - offsetY, _player.health, 10, C_RED);
 
   if (_bossActive && _boss.active && offsetY == 0) {
-    _canvas->setCursor(SCREEN_W / 2 - 20, 10);
-    _canvas->print("BOSS");
+    _hudBoss.draw(_canvas, SCREEN_W / 2 - 20, 10);
     _canvas->drawRect(SCREEN_W / 2 - 52, 25, 104, 8, C_RED);
     _canvas->fillRect(SCREEN_W / 2 - 51, 26, _boss.health, 6, C_RED);
   }
 
-  // Botón PAUSE (más grande)
-  _canvas->fillRoundRect(SCREEN_W - 70, 5 - offsetY, 60, 30, 5, C_ORNG);
-  _canvas->setTextColor(TFT_BLACK);
-  _canvas->setTextSize(1);
-  _canvas->setTextDatum(MC_DATUM);
-  _canvas->drawString("II", SCREEN_W - 40, 20 - offsetY);
-  _canvas->setTextDatum(TL_DATUM);
-
-  if (_showWaveText) {
-    _waveTextTimer--;
-    if (_waveTextTimer <= 0) {
-      _showWaveText = false;
-    } else {
-      _canvas->setTextDatum(MC_DATUM);
-      _canvas->setTextSize(2);
-      _canvas->setTextColor(C_YELL);
-      _canvas->drawString(_waveText, SCREEN_W / 2, SCREEN_H / 2 - offsetY);
-      _canvas->setTextSize(1);
-      _canvas->setTextDatum(TL_DATUM);
-    }
-  }
+  _hudPause.draw(_canvas, SCREEN_W - 70, 5 - offsetY);
 }
 
 void GameEngine::drawMenu(int offsetY) {
@@ -1203,18 +1357,8 @@ void GameEngine::drawShop(int offsetY) {
 
 // Asegúrate de que drawSkinPreview esté correctamente implementado:
 void GameEngine::drawSkinPreview(int centerX, int centerY, int skinId) {
-  const uint16_t *skin = player_skins[skinId];
-  int startX = centerX - PLAYER_W / 2;
-  int startY = centerY - PLAYER_H / 2;
-
-  for (int y = 0; y < PLAYER_H; y++) {
-    for (int x = 0; x < PLAYER_W; x++) {
-      uint16_t color = pgm_read_word(&skin[y * PLAYER_W + x]);
-      if (color != C_TRSP) {
-        _canvas->drawPixel(startX + x, startY + y, color);
-      }
-    }
-  }
+  drawRunSprite(_canvas, *player_skins[skinId], centerX - PLAYER_W / 2,
+                centerY - PLAYER_H / 2);
 }
 
 // Función helper para obtener color de preview
@@ -1,12 +1,20 @@
 #ifndef GAME_ENGINE_H
 #define GAME_ENGINE_H
 
+#include "CollisionGrid.h"
+#include "DisplayList.h"
+#include "Hud.h"
 #include "Input.h"
+#include "ParticleSystem.h"
+#include "Pool.h"
+#include "RenderPipeline.h"
+#include "SaveStore.h"
 #include <Arduino.h>
-#include <Preferences.h>
 #include <TFT_eSPI.h>
 #include <vector>
 
+struct RunSprite;
+
 enum GameState {
   STATE_MENU,
   STATE_PLAYING,
@@ -29,14 +37,87 @@ struct Entity {
   // New fields for formations
   float targetX, targetY;
   int state; // 0: Entrance, 1: Attack
+
+  float age; // Bullets: seconds since fired (swept from the muzzle)
+};
+
+// Everything kept across power cycles, stored as one record (SaveStore)
+struct ShooterSave {
+  int32_t coins;
+  int32_t highScore;
+  uint8_t ownedSkins; // Bit i: skin i bought
+  uint8_t equippedSkin;
+  uint8_t reserved[2];
+};
+
+// Everything draw() reads. The engine keeps it as a base so game code uses
+// the fields directly; in dual-core mode the simulation copies it into a
+// snapshot after its ticks and the render-side engine draws from a copy.
+// shopSkins (Assets.h) stays shared: its flags only change on a shop tap.
+struct RenderState {
+  GameState _state;
+  int _score;
+  int _highScore;
+  int _coins;        // Nuevo: sistema de monedas
+  int _equippedSkin; // Skin equipada actualmente
+
+  // Sized for the busiest waves seen; nothing is allocated while playing
+  // (see printPoolUsage)
+  Entity _player;
+  Pool<Entity, 16> _enemies;
+  Pool<Entity, 48> _bullets;
+  Pool<Entity, 4> _powerups;
+
+  // Explosion sprites (467 ms, 4 frames) and the sparks thrown by hits
+  ParticleSystem<32, 467, 4> _explosions;
+  ParticleSystem<256, 400, 4> _sparks;
+
+  // Boss
+  bool _bossActive;
+  Entity _boss;
+
+  // Wave Text
+  char _waveText[16];
+  bool _showWaveText;
+
+  int _shopScroll;
+
+  // Joystick navigation
+  int _selectedMenuItem;    // 0=Play, 1=Shop, 2=Exit
+  int _selectedShopItem;    // 0-NUM_SKINS for shop items
+  int _selectedPauseOption; // 0=Resume, 1=Menu
+
+  // Starfield
+  struct Star {
+    float x, y, speed; // speed in px/s
+    uint16_t color;
+  };
+  std::vector<Star> _stars;
 };
 
-class GameEngine {
+class GameEngine : private RenderState {
 public:
+  // Simulation tick and render target for LoopDriver
+  // Game logic is in seconds (speeds in px/s, timers in s) and scaled by
+  // dt, so the tick rate only sets input latency and collision granularity
+  static const int TICK_HZ = 120;
+  static const int RENDER_HZ = 60;
+
   GameEngine(TFT_eSPI *tft, Input *input);
-  void init();
+  void init(); // initSimulation() + initRender()
+  void initSimulation();
+  void initRender();
   void update(float dt);
-  void draw();
+  void draw(float alpha); // alpha: fraction of a tick since the last update
+  const PipelineStats &getPipelineStats() const { return _pipeline.stats(); }
+  uint32_t getPushedBytes() const { return _pipeline.stats().bytes; }
+
+  // Dual-core mode: copy the state out after ticking / into the render-side
+  // engine before drawing
+  void snapshot(RenderState &out) const { out = *this; }
+  void applySnapshot(const RenderState &state) {
+    RenderState::operator=(state);
+  }
 
   void startGame();
   void stopGame();
@@ -44,40 +125,29 @@ public:
 private:
   TFT_eSPI *_tft;
   Input *_input;
-  TFT_eSprite *_canvas;
+  RenderPipeline _pipeline;
+  TFT_eSprite *_canvas; // Strip buffer currently being drawn
   bool _useSprite;
 
-  GameState _state;
-  int _score;
-  int _highScore;
-  int _coins;        // Nuevo: sistema de monedas
-  int _equippedSkin; // Skin equipada actualmente
-
-  Entity _player;
-  std::vector<Entity> _enemies;
-  std::vector<Entity> _bullets;
-  std::vector<Entity> _particles;
-  std::vector<Entity> _powerups;
-
   // Boss
-  bool _bossActive;
-  Entity _boss;
-  int _bossShootTimer;
+  float _bossShootTimer; // Seconds since the boss last fired
 
-  // Game progression
+  // Game progression (timers in seconds of game time)
   int _waveNumber;
   int _enemiesKilled;
   unsigned long _gameStartTime;
-  int _powerupTimer;
+  float _gameTime;        // Since startGame, stops while paused
+  float _waveCooldown;    // Until the next wave may spawn
+  float _clearedAt;       // _gameTime the last enemy was killed or left
+  float _powerupTimer;    // Until the next power-up
+  float _shootTimer;      // Fire cooldown while A is held
+  float _touchShootTimer; // Same while touching
   bool _weaponPowerupActive;
-  unsigned long _weaponPowerupEnd;
+  float _weaponPowerupLeft;
 
   // Wave Text
-  String _waveText;
-  bool _showWaveText;
-  int _waveTextTimer;
+  float _waveTextTimer;
 
-  int _shopScroll;
   int _lastTouchX;
   bool _wasTouching;
   int _initialTouchX;
@@ -85,19 +155,19 @@ private:
   unsigned long _lastClickTime;
   bool _clickDebounce;
 
-  // Joystick navigation
-  int _selectedMenuItem;    // 0=Play, 1=Shop, 2=Exit
-  int _selectedShopItem;    // 0-NUM_SKINS for shop items
-  int _selectedPauseOption; // 0=Resume, 1=Menu
-  unsigned long _lastJoystickTime;
-  int _lastJoystickDir;
+  // HUD text and the pause button, rasterized only when they change
+  HudField _hudScore;
+  HudField _hudCoins;
+  HudField _hudBoss;
+  HudField _hudPause;
+  HudField _hudWave;
 
-  // Starfield
-  struct Star {
-    float x, y, speed;
-    uint16_t color;
-  };
-  std::vector<Star> _stars;
+  // Enemy broadphase for player bullets, rebuilt every tick (480x320 field)
+  CollisionGrid<480, 320, 32> _enemyGrid;
+
+  // Stars and sprites resolved once per frame, binned by 32-line band
+  enum DisplayKind : uint8_t { DL_STAR, DL_SPRITE };
+  DisplayList<256, 10> _displayList;
 
   void updatePlayer(float dt);
   void updateEnemies(float dt);
@@ -105,14 +175,22 @@ private:
   void updateParticles(float dt);
   void updatePowerups(float dt);
   void updateBoss(float dt);
-  void checkCollisions();
+  void checkCollisions(float dt);
+  void collectPowerups(float dt);
   void spawnEnemy();
-  void spawnEnemyWave();
-  void spawnFormation(int type); // New formation spawner
-  void spawnPowerup();
+  void spawnEnemyWave(float age);
+  void spawnFormation(int type, float age); // New formation spawner
+  void attackMove(Entity &e, float t, float dt);
+  void spawnPowerup(float age);
   void spawnBoss();
   void createExplosion(float x, float y, uint16_t color);
+  void emitSparks(float x, float y, int count, float speed);
+  void scheduleNextPowerup();
+  void spawnBullet(float x, float y, float vy, float age = 0);
+  void fireDue(float &timer, float dt);
+  void printPoolUsage();
   int getDifficultyLevel();
+  int enemiesLeft();
 
   // Nuevas funciones para tienda y skins
   void drawShop(int offsetY);
@@ -122,16 +200,15 @@ private:
   void equipSkin(int skinId);
   void saveGameData();
   void loadGameData();
+  void migrateSave();
   void returnToMainMenu();
 
   // Graphics helpers
-  void drawPlayer(int offsetY);
-  void drawEnemy(Entity &e, int offsetY);
-  void drawBullet(Entity &e, int offsetY);
-  void drawParticles(int offsetY);
-  void drawPowerup(Entity &p, int offsetY);
-  void drawBoss(int offsetY);
-  void drawExplosion(Entity &p, int offsetY);
+  ViewKey viewKey() const;
+  void buildDisplayList();
+  void addSprite(const RunSprite &sprite, float centerX, float centerY);
+  void drawDisplayList(int offsetY);
+  void drawSparks(int offsetY);
   void drawHUD(int offsetY);
   void drawMenu(int offsetY);
   void drawPauseMenu(int offsetY);
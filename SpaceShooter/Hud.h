@@ -0,0 +1,118 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Copies all of a 16-bit sprite into another with its top-left corner at
+// (x, y), relative to the destination's viewport, which must span the full
+// sprite width (as RenderPipeline bands do). Both buffers use the
+// TFT_eSprite byte order, so each row is a single memcpy.
+inline void blitSprite(TFT_eSprite *dst, TFT_eSprite *src, int x, int y) {
+  int vpY = dst->getViewportY();
+  int vpW = dst->getViewportWidth();
+  int vpH = dst->getViewportHeight();
+  int w = src->width();
+  int h = src->height();
+  int firstCol = max(0, -x);
+  int lastCol = min(w, vpW - x);
+  int firstRow = max(0, -y);
+  int lastRow = min(h, vpH - y);
+  if (firstCol >= lastCol || firstRow >= lastRow)
+    return;
+
+  const uint16_t *pixels = (const uint16_t *)src->getPointer();
+  uint16_t *buffer = (uint16_t *)dst->getPointer();
+  for (int row = firstRow; row < lastRow; row++)
+    memcpy(buffer + (vpY + y + row) * vpW + x + firstCol,
+           pixels + row * w + firstCol, (lastCol - firstCol) * 2);
+}
+
+// One HUD text field rendered into a small sprite with an opaque
+// background. The glyphs are only rasterized again when the text (or bound
+// value) changes; strips get a row copy of the bitmap.
+class HudField {
+public:
+  HudField()
+      : _sprite(nullptr), _font(2), _size(1), _datum(TL_DATUM), _fg(0),
+        _bg(0), _value(0), _hasValue(false) {
+    _text[0] = '\0';
+  }
+
+  // w x h must hold the longest text. The text is placed inside the field
+  // by datum (TL_DATUM: top-left corner, MC_DATUM: centered...). Returns
+  // false if the bitmap couldn't be allocated; the field then draws nothing.
+  bool begin(TFT_eSPI *tft, int w, int h, uint8_t font, uint16_t fg,
+             uint16_t bg, uint8_t datum = TL_DATUM, uint8_t size = 1) {
+    _sprite = new TFT_eSprite(tft);
+    _sprite->setColorDepth(16);
+    if (!_sprite->createSprite(w, h)) {
+      Serial.printf("HUD field %dx%d unavailable\n", w, h);
+      delete _sprite;
+      _sprite = nullptr;
+      return false;
+    }
+    _font = font;
+    _size = size;
+    _datum = datum;
+    _fg = fg;
+    _bg = bg;
+    render();
+    return true;
+  }
+
+  void setText(const char *text) {
+    if (strncmp(text, _text, sizeof(_text) - 1) == 0)
+      return;
+    snprintf(_text, sizeof(_text), "%s", text);
+    _hasValue = false;
+    render();
+  }
+
+  // Binds an integer shown through a printf format ("SCORE: %d"); nothing
+  // is formatted or rendered while the value stays the same
+  void setValue(const char *format, int value) {
+    if (_hasValue && value == _value)
+      return;
+    char text[sizeof(_text)];
+    snprintf(text, sizeof(text), format, value);
+    setText(text);
+    _value = value;
+    _hasValue = true;
+  }
+
+  // For fields with static artwork instead of text: draw into it once
+  TFT_eSprite *sprite() { return _sprite; }
+
+  void draw(TFT_eSprite *dst, int x, int y) const {
+    if (_sprite)
+      blitSprite(dst, _sprite, x, y);
+  }
+
+private:
+  TFT_eSprite *_sprite;
+  uint8_t _font;
+  uint8_t _size;
+  uint8_t _datum;
+  uint16_t _fg;
+  uint16_t _bg;
+  int _value;
+  bool _hasValue;
+  char _text[32];
+
+  void render() {
+    if (!_sprite)
+      return;
+    int w = _sprite->width();
+    int h = _sprite->height();
+    _sprite->fillSprite(_bg);
+    _sprite->setTextSize(_size);
+    _sprite->setTextDatum(_datum);
+    _sprite->setTextColor(_fg, _bg);
+    // Datums 0-8 run TL, TC, TR, ML ... BR
+    _sprite->drawString(_text, (_datum % 3) * w / 2, (_datum / 3) * h / 2,
+                        _font);
+  }
+};
+
+#endif
@@ -1,6 +1,12 @@
 #ifndef INPUT_H
 #define INPUT_H
 
+#include "InputEvents.h"
+#include "Joystick.h"
+#include "Profiler.h"
+#include "SaveStore.h"
+#include "TouchState.h"
+#include "TripleBuffer.h"
 #include <Arduino.h>
 #include <Wire.h>
 
@@ -13,8 +19,6 @@
 // Joystick pins
 #define JOYSTICK_X_PIN 15
 #define JOYSTICK_Y_PIN 16
-#define JOYSTICK_DEADZONE 800
-#define JOYSTICK_CENTER 2048
 
 #define BUTTON_A_PIN 11
 #define BUTTON_B_PIN 12
@@ -25,15 +29,6 @@ struct Point {
   bool touched;
 };
 
-// Direction enum for joystick
-enum InputDirection {
-  INPUT_DIR_UP,
-  INPUT_DIR_DOWN,
-  INPUT_DIR_LEFT,
-  INPUT_DIR_RIGHT,
-  INPUT_DIR_NONE
-};
-
 struct JoystickInput {
   int x;
   int y;
@@ -58,73 +53,106 @@ public:
     digitalWrite(TOUCH_RST, HIGH);
     delay(100);
 
+    // A task woken by the INT line reads the panel; getTouch() only reads
+    // the last state it published
+    pinMode(TOUCH_INT, INPUT_PULLUP);
+    if (xTaskCreatePinnedToCore(touchTask, "touch", 3072, this, 2, &_touchTask,
+                                0) == pdPASS) {
+      attachInterruptArg(TOUCH_INT, touchIsr, this, FALLING);
+    } else {
+      Serial.println("Touch task unavailable, polling the panel");
+      _touchTask = nullptr;
+    }
+
     // Initialize joystick pins
     pinMode(JOYSTICK_X_PIN, INPUT);
     pinMode(JOYSTICK_Y_PIN, INPUT);
+    if (!loadCalibration())
+      Serial.println("Joystick not calibrated, using defaults");
+    _filterX.reset(analogRead(JOYSTICK_X_PIN));
+    _filterY.reset(analogRead(JOYSTICK_Y_PIN));
 
     // Initialize buttons with internal pull-up
     pinMode(BUTTON_A_PIN, INPUT_PULLUP);
     pinMode(BUTTON_B_PIN, INPUT_PULLUP);
 
-    _lastAState = false;
-    _lastBState = false;
-  }
-
-  ButtonInput getButtons() {
-    ButtonInput btn;
+    _buttons = {false, false, false, false};
+    _nav = INPUT_DIR_NONE;
 
-    // Buttons are active LOW (pull-up)
-    bool aState = !digitalRead(BUTTON_A_PIN);
-    bool bState = !digitalRead(BUTTON_B_PIN);
-
-    btn.aPressed = aState;
-    btn.bPressed = bState;
-
-    // Detect rising edge (just pressed)
-    btn.aJustPressed = aState && !_lastAState;
-    btn.bJustPressed = bState && !_lastBState;
+    // Buttons and joystick are sampled at 1 kHz by a task above the games'
+    // priority; poll() drains what it saw once per tick
+    if (xTaskCreatePinnedToCore(samplerTask, "input", 3072, this, 5,
+                                &_samplerTask, 0) != pdPASS) {
+      Serial.println("Input sampler unavailable, sampling on poll");
+      _samplerTask = nullptr;
+    }
+  }
 
-    _lastAState = aState;
-    _lastBState = bState;
+  // Takes in the events sampled since the last call. Call once per tick:
+  // getButtons() and getNavigation() then describe that tick however often
+  // they are read, so no press is lost or seen twice.
+  void poll() {
+    if (!_samplerTask)
+      sample();
+    _buttons.aJustPressed = false;
+    _buttons.bJustPressed = false;
+    _nav = INPUT_DIR_NONE;
+    InputEvent event;
+    while (_sampler.pop(event)) {
+      bool pressed = event.type == INPUT_PRESS;
+      switch (event.source) {
+      case INPUT_BUTTON_A:
+        _buttons.aPressed = pressed;
+        _buttons.aJustPressed |= pressed;
+        break;
+      case INPUT_BUTTON_B:
+        _buttons.bPressed = pressed;
+        _buttons.bJustPressed |= pressed;
+        break;
+      case INPUT_JOYSTICK:
+        _nav = (InputDirection)event.dir;
+        break;
+      }
+    }
+    // A+B toggles the profiler overlay. The chord is swallowed: from the
+    // tick both are down until both are up again the game sees neither
+    // button, so pressing them together does not fire, select or pause.
+    bool both = _buttons.aPressed && _buttons.bPressed;
+    _chord = both || (_chord && (_buttons.aPressed || _buttons.bPressed));
+    Profiler::chord(_chord);
+  }
 
-    return btn;
+  ButtonInput getButtons() const {
+    if (_chord)
+      return {false, false, false, false};
+    return _buttons;
   }
 
+  // Direction to move a menu selection this tick: once when the joystick
+  // is pushed, then repeating while it is held. NONE otherwise.
+  InputDirection getNavigation() const { return _nav; }
+
   Point getTouch(int screenWidth, int screenHeight) {
+    PROFILE_SCOPE(PROF_INPUT);
     Point p = {0, 0, false};
 
-    Wire.beginTransmission(FT6336_ADDR);
-    Wire.write(0x02);
-    if (Wire.endTransmission() != 0)
-      return p;
-
-    Wire.requestFrom(FT6336_ADDR, 1);
-    if (Wire.available() < 1)
-      return p;
-
-    uint8_t touches = Wire.read() & 0x0F;
-    if (touches == 0)
-      return p;
-
-    Wire.beginTransmission(FT6336_ADDR);
-    Wire.write(0x03);
-    if (Wire.endTransmission() != 0)
-      return p;
-
-    Wire.requestFrom(FT6336_ADDR, 4);
-    if (Wire.available() < 4)
+    const TouchState *state;
+    TouchState polled;
+    if (_touchTask) {
+      _touch.acquire();
+      state = &_touch.front();
+    } else {
+      uint8_t regs[FT6336_BURST_LEN];
+      if (!readTouchRegs(regs))
+        return p;
+      polled = decodeTouch(regs);
+      state = &polled;
+    }
+    if (state->touches == 0)
       return p;
 
-    uint8_t xh = Wire.read();
-    uint8_t xl = Wire.read();
-    uint8_t yh = Wire.read();
-    uint8_t yl = Wire.read();
-
-    uint16_t raw_x = ((xh & 0x0F) << 8) | xl;
-    uint16_t raw_y = ((yh & 0x0F) << 8) | yl;
-
-    p.x = screenWidth - raw_y;
-    p.y = raw_x;
+    p.x = screenWidth - state->y[0];
+    p.y = state->x[0];
 
     p.x = constrain(p.x, 0, screenWidth - 1);
     p.y = constrain(p.y, 0, screenHeight - 1);
@@ -133,37 +161,149 @@ public:
     return p;
   }
 
+  // micros() of the INT edge behind the last touch reading
+  uint32_t getTouchTime() const { return _touch.front().time; }
+
   JoystickInput getJoystick() {
-    JoystickInput joy = {0, 0, INPUT_DIR_NONE, false};
+    PROFILE_SCOPE(PROF_INPUT);
+    JoystickInput joy;
+    int x, y;
+    getJoystickRaw(x, y);
+    joy.x = joystickAxis(x, _cal.centerX, _cal.minX, _cal.maxX);
+    joy.y = joystickAxis(y, _cal.centerY, _cal.minY, _cal.maxY);
+    joy.direction = joystickDirection(joy.x, joy.y, _cal.deadzone);
+    joy.active = joy.direction != INPUT_DIR_NONE;
+    if (!joy.active)
+      joy.x = joy.y = 0; // Centred inside the deadzone
+    return joy;
+  }
 
-    int rawX = analogRead(JOYSTICK_X_PIN);
-    int rawY = analogRead(JOYSTICK_Y_PIN);
+  // Filtered ADC counts, before calibration: one load of the last sample
+  void getJoystickRaw(int &x, int &y) const {
+    uint32_t raw = _joystickRaw.load(std::memory_order_relaxed);
+    x = raw >> 16;
+    y = raw & 0xFFFF;
+  }
 
-    joy.x = rawX - JOYSTICK_CENTER;
-    joy.y = rawY - JOYSTICK_CENTER;
+  // Calibration shared by the launcher and the games, as one record in
+  // its own NVS namespace
+  const JoystickCalibration &getCalibration() const { return _cal; }
+  void setCalibration(const JoystickCalibration &cal) {
+    _cal = cal;
+    _samplerCal.back() = cal;
+    _samplerCal.publish();
+  }
+  bool loadCalibration() {
+    SaveStore<JoystickCalibration, 1> store;
+    if (!store.begin("joystick"))
+      return false;
+    setCalibration(store.get());
+    return true;
+  }
+  bool saveCalibration(const JoystickCalibration &cal) {
+    SaveStore<JoystickCalibration, 1> store;
+    store.begin("joystick");
+    store.set(cal);
+    store.flush();
+    if (store.dirty())
+      return false;
+    setCalibration(cal);
+    return true;
+  }
 
-    // Apply deadzone
-    if (abs(joy.x) < JOYSTICK_DEADZONE && abs(joy.y) < JOYSTICK_DEADZONE) {
-      return joy;
-    }
+  Input()
+      : _chord(false), _nav(INPUT_DIR_NONE), _samplerTask(nullptr),
+        _joystickRaw(JOYSTICK_CENTER << 16 | JOYSTICK_CENTER),
+        _touchTask(nullptr) {
+    _buttons = {false, false, false, false};
+    setCalibration(defaultCalibration());
+  }
 
-    joy.active = true;
+private:
+  ButtonInput _buttons; // This tick, set by poll()
+  bool _chord;          // A+B held for the profiler, hidden from the game
+  InputDirection _nav;  // This tick, set by poll()
+  InputSampler _sampler;
+  TaskHandle_t _samplerTask;
+  std::atomic<uint32_t> _joystickRaw; // Last filtered sample, x << 16 | y
+  JoystickFilter _filterX, _filterY;  // Sampler only
+  JoystickCalibration _cal;           // Caller's copy
+  TripleBuffer<JoystickCalibration> _samplerCal; // _cal, for the sampler
+
+  void sample() {
+    int x = _filterX.update(analogRead(JOYSTICK_X_PIN));
+    int y = _filterY.update(analogRead(JOYSTICK_Y_PIN));
+    _joystickRaw.store(x << 16 | y, std::memory_order_relaxed);
+    _samplerCal.acquire();
+    const JoystickCalibration &cal = _samplerCal.front();
+    InputDirection dir = joystickDirection(
+        joystickAxis(x, cal.centerX, cal.minX, cal.maxX),
+        joystickAxis(y, cal.centerY, cal.minY, cal.maxY), cal.deadzone);
+    // Buttons are active LOW (pull-up)
+    _sampler.sample(!digitalRead(BUTTON_A_PIN), !digitalRead(BUTTON_B_PIN), dir,
+                    micros());
+  }
 
-    // Determine dominant direction
-    if (abs(joy.x) > abs(joy.y)) {
-      joy.direction = (joy.x > 0) ? INPUT_DIR_RIGHT : INPUT_DIR_LEFT;
-    } else {
-      joy.direction = (joy.y > 0) ? INPUT_DIR_DOWN : INPUT_DIR_UP;
+  // Every sample one FreeRTOS tick apart: below 1 kHz pdMS_TO_TICKS(1)
+  // would round to 0 and the task would spin without ever blocking
+  static_assert(configTICK_RATE_HZ >= 1000,
+                "the input sampler needs a 1 kHz FreeRTOS tick");
+
+  static void samplerTask(void *arg) {
+    Input *input = (Input *)arg;
+    TickType_t wake = xTaskGetTickCount();
+    for (;;) {
+      input->sample();
+      vTaskDelayUntil(&wake, pdMS_TO_TICKS(1));
     }
+  }
 
-    return joy;
+  TaskHandle_t _touchTask;
+  volatile uint32_t _touchEdgeTime; // Set by touchIsr
+  TripleBuffer<TouchState> _touch;  // Written by touchTask only
+
+  // Status and both points in one transaction
+  static bool readTouchRegs(uint8_t regs[FT6336_BURST_LEN]) {
+    Wire.beginTransmission(FT6336_ADDR);
+    Wire.write(FT6336_REG_STATUS);
+    if (Wire.endTransmission(false) != 0)
+      return false;
+    if (Wire.requestFrom(FT6336_ADDR, FT6336_BURST_LEN) != FT6336_BURST_LEN)
+      return false;
+    for (int i = 0; i < FT6336_BURST_LEN; i++)
+      regs[i] = Wire.read();
+    return true;
   }
 
-  Input() : _lastAState(false), _lastBState(false) {}
+  static void IRAM_ATTR touchIsr(void *arg) {
+    Input *input = (Input *)arg;
+    input->_touchEdgeTime = micros();
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(input->_touchTask, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
 
-private:
-  bool _lastAState;
-  bool _lastBState;
+  // Sleeps until the panel pulls INT low. While a finger is down the panel
+  // keeps pulsing INT; the timeout catches the release in case its pulse
+  // is missed.
+  static void touchTask(void *arg) {
+    Input *input = (Input *)arg;
+    uint32_t seq = 0;
+    bool down = false;
+    for (;;) {
+      bool edge = ulTaskNotifyTake(pdTRUE, down ? pdMS_TO_TICKS(50)
+                                                : portMAX_DELAY) > 0;
+      uint8_t regs[FT6336_BURST_LEN];
+      if (!readTouchRegs(regs))
+        continue;
+      TouchState &state = input->_touch.back();
+      state = decodeTouch(regs);
+      state.time = edge ? input->_touchEdgeTime : micros();
+      state.seq = ++seq;
+      input->_touch.publish();
+      down = state.touches > 0;
+    }
+  }
 };
 
 #endif
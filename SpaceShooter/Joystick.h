@@ -0,0 +1,142 @@
+#ifndef JOYSTICK_H
+#define JOYSTICK_H
+
+#include <stdint.h>
+
+// Uncalibrated stick: nominal center of the 12-bit ADC and a deadzone wide
+// enough to hide an off-center stick
+#define JOYSTICK_DEADZONE 800
+#define JOYSTICK_CENTER 2048
+
+// Full deflection as reported by getJoystick(), whatever the stick's range
+#define JOYSTICK_SCALE 2047
+// Narrowest deadzone a calibration may set, in JOYSTICK_SCALE units
+#define JOYSTICK_MIN_DEADZONE 300
+
+// Per-unit calibration. Center and range are in raw ADC counts, the
+// deadzone is in JOYSTICK_SCALE units. Only <stdint.h>, so this file also
+// builds on a host.
+struct JoystickCalibration {
+  uint16_t centerX, centerY;
+  uint16_t minX, maxX;
+  uint16_t minY, maxY;
+  uint16_t deadzone;
+  uint16_t reserved;
+};
+
+inline JoystickCalibration defaultCalibration() {
+  JoystickCalibration cal = {};
+  cal.centerX = cal.centerY = JOYSTICK_CENTER;
+  cal.maxX = cal.maxY = 4095;
+  cal.deadzone = JOYSTICK_DEADZONE;
+  return cal;
+}
+
+// One raw reading to -JOYSTICK_SCALE..JOYSTICK_SCALE. Each side of the
+// center is scaled to its own travel, since sticks rarely rest in the
+// middle of their range.
+inline int joystickAxis(int raw, int center, int lo, int hi) {
+  int span = raw >= center ? hi - center : center - lo;
+  if (span <= 0)
+    return 0;
+  int v = (raw - center) * JOYSTICK_SCALE / span;
+  return v > JOYSTICK_SCALE ? JOYSTICK_SCALE
+                            : (v < -JOYSTICK_SCALE ? -JOYSTICK_SCALE : v);
+}
+
+// Cleans up one ADC channel sampled at a fixed rate: the median of the
+// last three samples drops single-sample spikes, then an exponential
+// average (weight 1 / 2^SHIFT) takes out the noise. The average is kept
+// in 1/16 counts so it doesn't stall short of the input.
+class JoystickFilter {
+public:
+  static const int SHIFT = 2; // About 4 samples, 4 ms at 1 kHz
+
+  JoystickFilter() { reset(JOYSTICK_CENTER); }
+
+  void reset(int raw) {
+    _prev[0] = _prev[1] = raw;
+    _avg = raw << 4;
+  }
+
+  int update(int raw) {
+    int a = _prev[0], b = _prev[1];
+    int median = a < b ? (raw < a ? a : (raw < b ? raw : b))
+                       : (raw < b ? b : (raw < a ? raw : a));
+    _prev[0] = b;
+    _prev[1] = raw;
+    _avg += ((median << 4) - _avg) >> SHIFT;
+    return (_avg + 8) >> 4;
+  }
+
+private:
+  int _prev[2]; // Oldest first
+  int _avg;
+};
+
+// Builds a calibration from filtered readings: sampleRest() while the
+// stick is left alone gives the center and the noise around it, then
+// sampleTravel() while it is swept to its stops gives the range.
+class JoystickCalibrator {
+public:
+  static const int MIN_TRAVEL = 600; // Counts each side of the center
+
+  JoystickCalibrator()
+      : _sumX(0), _sumY(0), _rest(0), _restMin{4095, 4095}, _restMax{0, 0},
+        _min{4095, 4095}, _max{0, 0} {}
+
+  void sampleRest(int x, int y) {
+    _sumX += x;
+    _sumY += y;
+    _rest++;
+    track(_restMin, _restMax, x, y);
+  }
+
+  void sampleTravel(int x, int y) { track(_min, _max, x, y); }
+
+  // False when the capture can't be right: no rest samples, or less than
+  // MIN_TRAVEL on some side of the center (stick not swept to its stops)
+  bool result(JoystickCalibration &cal) const {
+    if (_rest == 0)
+      return false;
+    int cx = (_sumX + _rest / 2) / _rest;
+    int cy = (_sumY + _rest / 2) / _rest;
+    if (cx - _min[0] < MIN_TRAVEL || _max[0] - cx < MIN_TRAVEL ||
+        cy - _min[1] < MIN_TRAVEL || _max[1] - cy < MIN_TRAVEL)
+      return false;
+
+    // Three times the noise seen at rest, so a released stick never
+    // drifts out of it
+    int dx = joystickAxis(_restMax[0], cx, _min[0], _max[0]) -
+             joystickAxis(_restMin[0], cx, _min[0], _max[0]);
+    int dy = joystickAxis(_restMax[1], cy, _min[1], _max[1]) -
+             joystickAxis(_restMin[1], cy, _min[1], _max[1]);
+    int deadzone = 3 * (dx > dy ? dx : dy);
+    if (deadzone < JOYSTICK_MIN_DEADZONE)
+      deadzone = JOYSTICK_MIN_DEADZONE;
+
+    cal = {(uint16_t)cx,      (uint16_t)cy,      (uint16_t)_min[0],
+           (uint16_t)_max[0], (uint16_t)_min[1], (uint16_t)_max[1],
+           (uint16_t)deadzone, 0};
+    return true;
+  }
+
+private:
+  int32_t _sumX, _sumY;
+  int32_t _rest; // Rest samples
+  int _restMin[2], _restMax[2];
+  int _min[2], _max[2];
+
+  static void track(int lo[2], int hi[2], int x, int y) {
+    if (x < lo[0])
+      lo[0] = x;
+    if (x > hi[0])
+      hi[0] = x;
+    if (y < lo[1])
+      lo[1] = y;
+    if (y > hi[1])
+      hi[1] = y;
+  }
+};
+
+#endif
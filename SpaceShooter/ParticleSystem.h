@@ -0,0 +1,98 @@
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include <stdint.h>
+
+// Particles that only drift and age (explosions, sparks), stored as a
+// structure of arrays. update() is a branch-free pass over plain arrays
+// the compiler can vectorize. Velocities are in units per second.
+//
+// Every particle lives LIFE_MS and goes through FRAMES animation frames of
+// equal length, frame 0 while it is new. Since they all live equally
+// long, the arrays are a ring in spawn order and the expired particles are
+// always the oldest ones at its head: dropping them moves nothing.
+//
+// Drawing walks one frame at a time (forEach), so each batch shares its
+// sprite or colour.
+//
+// Only <stdint.h>, so it also builds on a host.
+template <int N, int LIFE_MS, int FRAMES> class ParticleSystem {
+public:
+  ParticleSystem() : _head(0), _count(0), _highWater(0), _dropped(0) {}
+
+  // False when full (counted in dropped())
+  bool spawn(float x, float y, float vx, float vy) {
+    if (_count == N) {
+      _dropped++;
+      return false;
+    }
+    int i = (_head + _count++) % N;
+    if (_count > _highWater)
+      _highWater = _count;
+    _x[i] = x;
+    _y[i] = y;
+    _vx[i] = vx;
+    _vy[i] = vy;
+    _life[i] = LIFE_MS / 1000.0f;
+    _frame[i] = 0;
+    return true;
+  }
+
+  // Advances dt seconds
+  void update(float dt) {
+    int end = _head + _count;
+    step(_head, end < N ? end : N, dt);
+    if (end > N)
+      step(0, end - N, dt); // Wrapped part of the ring
+    // The margin absorbs float rounding: a life of a whole number of ticks
+    // ends on that tick
+    while (_count > 0 && _life[_head] < 0.0001f) {
+      _head = (_head + 1) % N;
+      _count--;
+    }
+  }
+
+  // Calls fn(x, y) for every particle showing the given frame
+  template <typename F> void forEach(int frame, F fn) const {
+    for (int k = 0; k < _count; k++) {
+      int i = (_head + k) % N;
+      if (_frame[i] == frame)
+        fn(_x[i], _y[i]);
+    }
+  }
+
+  void clear() {
+    _head = 0;
+    _count = 0;
+  }
+  int size() const { return _count; }
+
+  // Tuning: most particles alive at once since boot, and spawns refused
+  static int capacity() { return N; }
+  int highWater() const { return _highWater; }
+  uint32_t dropped() const { return _dropped; }
+
+private:
+  float _x[N];
+  float _y[N];
+  float _vx[N];
+  float _vy[N];
+  float _life[N]; // Seconds left
+  uint8_t _frame[N];
+  int _head; // Oldest particle
+  int _count;
+  int _highWater;
+  uint32_t _dropped;
+
+  void step(int first, int last, float dt) {
+    const float framesPerSecond = FRAMES * 1000.0f / LIFE_MS;
+    for (int i = first; i < last; i++) {
+      _x[i] += _vx[i] * dt;
+      _y[i] += _vy[i] * dt;
+      _life[i] -= dt;
+      _frame[i] = (LIFE_MS / 1000.0f - _life[i]) * framesPerSecond;
+    }
+  }
+};
+
+#endif
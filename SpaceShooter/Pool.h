@@ -0,0 +1,60 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdint.h>
+
+// Fixed-capacity storage for N items, no heap use after construction.
+//
+// Live items are kept packed in [0, size()) so loops run over them like a
+// vector. spawn() appends in O(1) and returns null when the pool is full;
+// remove(i) moves the last item into slot i, so removing while iterating
+// must walk backwards. Removal reorders items.
+//
+// Only <stdint.h>, so it also builds on a host.
+template <typename T, int N> class Pool {
+public:
+  Pool() : _count(0), _highWater(0), _dropped(0) {}
+
+  // The slot still holds whatever was removed from it last, so the caller
+  // sets every field. Null when full, counted in dropped().
+  T *spawn() {
+    if (_count == N) {
+      _dropped++;
+      return nullptr;
+    }
+    int i = _count++;
+    if (_count > _highWater)
+      _highWater = _count;
+    return &_items[i];
+  }
+
+  void remove(int i) {
+    int last = --_count;
+    if (i != last)
+      _items[i] = _items[last];
+  }
+
+  void clear() { _count = 0; }
+
+  int size() const { return _count; }
+  bool empty() const { return _count == 0; }
+  T &operator[](int i) { return _items[i]; }
+  const T &operator[](int i) const { return _items[i]; }
+  T *begin() { return _items; }
+  T *end() { return _items + _count; }
+  const T *begin() const { return _items; }
+  const T *end() const { return _items + _count; }
+
+  // Tuning: most items alive at once since boot, and spawns refused
+  static int capacity() { return N; }
+  int highWater() const { return _highWater; }
+  uint32_t dropped() const { return _dropped; }
+
+private:
+  T _items[N];
+  int _count;
+  int _highWater;
+  uint32_t _dropped;
+};
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef RUN_SPRITE_H
+#define RUN_SPRITE_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Opaque pixels stored as horizontal runs of 8-bit palette indices. Palette
+// entries are byte-swapped like the TFT_eSprite 16-bit buffer, so a run is
+// copied with one table lookup per pixel.
+struct SpriteRun {
+  uint8_t x;      // First column of the run
+  uint8_t len;    // Opaque pixels in the run
+  uint16_t pixel; // Index of the run's first pixel in RunSprite::pixels
+};
+
+// Tables are generated by tools/sprite_compiler.py and live in flash. Only
+// the opaque bounding box (ox, oy, bw, bh) inside the w x h frame is stored.
+// Sprites whose art differs only in colour can share the index tables and
+// swap palettes.
+struct RunSprite {
+  int16_t w, h;             // Frame size, what callers position against
+  int16_t ox, oy;           // Opaque box offset inside the frame
+  int16_t bw, bh;           // Opaque box size
+  const uint16_t *rowStart; // bh + 1 entries; row y owns runs
+                            // [rowStart[y], rowStart[y + 1])
+  const SpriteRun *runs;
+  const uint8_t *pixels;   // Palette indices
+  const uint16_t *palette; // Up to 256 colours, panel byte order
+};
+
+// Copies a run sprite with its frame's top-left corner at (x, y) into a 16-bit
+// sprite. Coordinates are relative to the sprite's viewport, which must span
+// the full sprite width (as RenderPipeline bands do). Clipping is done once
+// per sprite for rows and once per run for columns. palette overrides the
+// sprite's own (same index layout) for recoloured variants.
+inline void drawRunSprite(TFT_eSprite *dst, const RunSprite &s, int x, int y,
+                          const uint16_t *palette = nullptr) {
+  int vpY = dst->getViewportY();
+  int vpW = dst->getViewportWidth();
+  int vpH = dst->getViewportHeight();
+  x += s.ox;
+  y += s.oy;
+  if (x >= vpW || x + s.bw <= 0)
+    return;
+  int firstRow = max(0, -y);
+  int lastRow = min((int)s.bh, vpH - y);
+  if (firstRow >= lastRow)
+    return;
+
+  if (!palette)
+    palette = s.palette;
+  uint16_t *buffer = (uint16_t *)dst->getPointer();
+  for (int row = firstRow; row < lastRow; row++) {
+    uint16_t *line = buffer + (vpY + y + row) * vpW;
+    for (int r = s.rowStart[row]; r < s.rowStart[row + 1]; r++) {
+      const SpriteRun &run = s.runs[r];
+      const uint8_t *src = s.pixels + run.pixel;
+      int dx = x + run.x;
+      int len = run.len;
+      if (dx < 0) {
+        src -= dx;
+        len += dx;
+        dx = 0;
+      }
+      if (dx + len > vpW)
+        len = vpW - dx;
+      uint16_t *out = line + dx;
+      for (int i = 0; i < len; i++)
+        out[i] = palette[src[i]];
+    }
+  }
+}
+
+#endif
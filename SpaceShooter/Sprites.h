@@ -0,0 +1,566 @@
+// Generated by tools/sprite_compiler.py - do not edit.
+// Sources: boss_ship.png bullet_sprite.png enemy_ship.png explosion.16x16.png player_ship.png player_ship_blue.png player_ship_green.png player_ship_red.png powerup_shield.png powerup_weapon.png
+// Pixels: 3336 stored of 8544 in the source frames, 701 palette entries
+#ifndef SPRITES_H
+#define SPRITES_H
+
+#include "RunSprite.h"
+
+// Opaque pixels as indices into each sprite's palette
+constexpr uint8_t sprites_pixels[] = {
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    2, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 3, 0, 0, 0, 1,
+    1, 1, 1, 0, 0, 0, 2, 0, 0, 0, 0, 1, 1, 1, 1, 0,
+    0, 0, 0, 1, 1, 2, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 4, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 5, 4, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 5,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, 7, 7, 7, 7, 6, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 8, 7, 7, 7, 7, 8, 0, 0, 0, 0, 2,
+    0, 0, 0, 6, 7, 7, 7, 7, 7, 7, 6, 0, 0, 0, 9, 0,
+    0, 8, 7, 7, 7, 7, 7, 7, 8, 0, 0, 9, 0, 6, 7, 7,
+    7, 7, 7, 7, 7, 7, 6, 0, 0, 8, 7, 7, 7, 7, 7, 7,
+    7, 7, 8, 5, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 0, 0, 0, 9, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 0, 0,
+    10, 10, 0, 0, 10, 10, 0, 0, 0, 0, 0, 0, 10, 10, 10, 11,
+    11, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10, 10, 0, 0, 10,
+    10, 0, 0, 10, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 11,
+    11, 10, 10, 10, 0, 0, 0, 0, 10, 10, 10, 11, 11, 10, 10, 10,
+    1, 1, 1, 0, 0, 0, 0, 10, 10, 0, 0, 10, 10, 0, 0, 10,
+    10, 0, 0, 0, 0, 1, 1, 1, 10, 10, 10, 11, 11, 10, 10, 10,
+    0, 0, 0, 0, 12, 12, 10, 13, 14, 10, 10, 10, 10, 10, 10, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0,
+    0, 10, 10, 10, 10, 10, 10, 14, 13, 10, 12, 12, 0, 0, 2, 3,
+    4, 1, 5, 6, 7, 8, 9, 10, 7, 11, 12, 13, 7, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 1, 2, 2, 3, 4, 5,
+    5, 4, 6, 7, 7, 8, 4, 9, 10, 11, 11, 6, 12, 13, 14, 11,
+    11, 15, 16, 17, 11, 7, 7, 18, 8, 12, 19, 20, 16, 16, 20, 19,
+    12, 21, 21, 16, 22, 23, 24, 24, 25, 22, 8, 26, 4, 27, 28, 4,
+    21, 29, 10, 24, 30, 31, 32, 10, 29, 21, 4, 28, 27, 28, 33, 4,
+    34, 23, 23, 30, 29, 29, 35, 23, 23, 34, 4, 36, 28, 37, 28, 38,
+    39, 40, 23, 41, 21, 22, 22, 21, 41, 23, 40, 42, 43, 44, 45, 9,
+    4, 46, 47, 46, 48, 49, 50, 51, 40, 16, 4, 52, 11, 11, 52, 4,
+    16, 40, 53, 54, 55, 48, 46, 47, 56, 47, 57, 58, 59, 4, 60, 61,
+    40, 62, 63, 11, 11, 11, 11, 63, 62, 40, 64, 65, 4, 66, 58, 57,
+    47, 47, 67, 68, 69, 39, 70, 71, 40, 23, 11, 11, 11, 11, 11, 11,
+    23, 40, 71, 72, 39, 69, 68, 67, 47, 47, 67, 68, 69, 71, 71, 71,
+    73, 21, 74, 11, 11, 11, 11, 10, 21, 73, 71, 71, 71, 75, 68, 67,
+    47, 47, 67, 68, 69, 71, 76, 77, 78, 21, 19, 79, 80, 80, 52, 8,
+    81, 78, 77, 76, 71, 75, 68, 67, 47, 47, 67, 68, 82, 48, 21, 16,
+    24, 23, 22, 83, 83, 83, 83, 14, 23, 24, 49, 21, 48, 82, 68, 67,
+    47, 58, 84, 4, 27, 16, 24, 21, 85, 23, 11, 11, 11, 11, 11, 11,
+    23, 85, 21, 24, 16, 27, 4, 84, 58, 9, 27, 4, 16, 86, 40, 87,
+    11, 22, 49, 49, 10, 11, 87, 40, 88, 16, 4, 27, 9, 26, 21, 89,
+    90, 4, 91, 60, 92, 93, 24, 17, 4, 90, 89, 21, 26, 16, 94, 82,
+    48, 26, 4, 60, 95, 95, 60, 4, 21, 82, 96, 16, 24, 21, 21, 21,
+    21, 24, 18, 19, 7, 41, 42, 43, 44, 45, 46, 47, 48, 65, 66, 19,
+    67, 7, 7, 68, 69, 7, 70, 0, 71, 87, 88, 89, 90, 91, 92, 93,
+    7, 94, 95, 50, 19, 107, 93, 108, 109, 110, 111, 93, 112, 113, 113, 19,
+    43, 89, 132, 133, 134, 135, 136, 91, 137, 95, 70, 113, 113, 149, 150, 151,
+    152, 135, 153, 154, 155, 46, 113, 48, 7, 167, 168, 169, 132, 170, 171, 172,
+    92, 93, 173, 174, 175, 176, 185, 19, 43, 186, 68, 170, 187, 91, 188, 47,
+    113, 43, 155, 0, 19, 116, 95, 90, 132, 91, 132, 66, 87, 70, 9, 19,
+    210, 211, 211, 168, 212, 210, 19, 19, 218, 69, 113, 219, 220, 221, 222, 19,
+    155, 236, 237, 20, 21, 22, 23, 24, 25, 25, 26, 27, 28, 8, 8, 11,
+    12, 49, 50, 51, 52, 53, 54, 55, 53, 32, 56, 57, 57, 58, 12, 72,
+    73, 74, 75, 76, 36, 36, 43, 77, 53, 78, 79, 96, 56, 32, 34, 97,
+    13, 36, 36, 98, 99, 100, 56, 28, 114, 115, 53, 116, 36, 117, 118, 13,
+    119, 120, 121, 122, 24, 1, 10, 138, 54, 36, 13, 139, 140, 33, 97, 13,
+    13, 141, 142, 10, 143, 1, 10, 156, 55, 120, 98, 157, 13, 158, 159, 97,
+    33, 141, 160, 10, 143, 28, 177, 53, 178, 13, 13, 36, 179, 180, 33, 99,
+    122, 181, 8, 23, 52, 32, 189, 190, 191, 36, 13, 192, 193, 194, 32, 195,
+    12, 22, 27, 100, 34, 201, 43, 36, 36, 202, 52, 177, 203, 204, 58, 213,
+    27, 32, 195, 55, 55, 53, 32, 204, 214, 20, 11, 223, 224, 20, 24, 225,
+    226, 25, 227, 225, 114, 228, 229, 8, 20, 29, 30, 31, 32, 32, 33, 33,
+    15, 34, 14, 59, 34, 30, 60, 32, 32, 61, 61, 32, 32, 32, 62, 30,
+    62, 15, 32, 32, 32, 80, 81, 13, 13, 80, 32, 32, 29, 30, 32, 32,
+    32, 33, 13, 4, 4, 33, 101, 32, 34, 14, 15, 32, 80, 13, 4, 123,
+    13, 124, 13, 125, 32, 32, 3, 13, 101, 61, 13, 13, 13, 144, 13, 13,
+    13, 13, 33, 33, 13, 33, 3, 13, 61, 13, 13, 123, 144, 13, 13, 161,
+    13, 13, 33, 61, 13, 33, 15, 32, 32, 182, 13, 13, 4, 13, 13, 13,
+    101, 34, 32, 15, 32, 32, 196, 13, 33, 4, 13, 197, 101, 198, 32, 32,
+    205, 15, 32, 32, 32, 206, 13, 13, 80, 32, 32, 32, 14, 30, 29, 215,
+    32, 32, 13, 61, 32, 32, 216, 62, 30, 30, 30, 230, 15, 32, 13, 61,
+    32, 32, 231, 30, 30, 238, 16, 17, 16, 35, 36, 6, 37, 38, 39, 37,
+    40, 6, 6, 63, 64, 35, 37, 37, 37, 37, 37, 37, 17, 16, 6, 6,
+    17, 82, 83, 84, 37, 40, 85, 86, 37, 35, 17, 17, 36, 17, 63, 102,
+    103, 104, 85, 105, 106, 37, 16, 6, 63, 102, 126, 127, 128, 129, 130, 131,
+    40, 40, 37, 40, 145, 6, 36, 127, 146, 130, 130, 130, 147, 148, 86, 37,
+    37, 5, 17, 17, 162, 163, 163, 164, 130, 130, 165, 166, 37, 37, 16, 16,
+    84, 127, 103, 183, 130, 130, 184, 37, 6, 102, 199, 64, 130, 200, 164, 164,
+    86, 37, 6, 64, 64, 6, 3, 207, 37, 208, 209, 207, 40, 6, 17, 6,
+    6, 3, 217, 37, 40, 3, 165, 184, 37, 6, 6, 232, 233, 37, 234, 166,
+    235, 40, 37, 37, 38, 0, 1, 1, 0, 2, 3, 4, 5, 6, 1, 7,
+    8, 5, 5, 9, 10, 11, 12, 5, 5, 5, 13, 14, 15, 16, 5, 5,
+    5, 17, 7, 18, 19, 20, 21, 21, 20, 5, 20, 0, 22, 0, 18, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 31, 35, 36, 37, 38,
+    39, 40, 36, 41, 10, 34, 33, 32, 45, 46, 36, 37, 38, 39, 40, 36,
+    5, 47, 44, 43, 48, 32, 49, 50, 51, 46, 36, 37, 38, 39, 40, 36,
+    5, 47, 50, 49, 32, 51, 46, 36, 55, 56, 57, 58, 36, 5, 13, 54,
+    53, 52, 2, 51, 46, 59, 60, 28, 14, 60, 59, 5, 61, 1, 14, 62,
+    51, 46, 5, 5, 63, 63, 5, 5, 5, 61, 64, 31, 31, 11, 65, 66,
+    46, 5, 5, 5, 5, 5, 5, 5, 61, 67, 68, 1, 69, 70, 71, 66,
+    46, 5, 72, 73, 74, 72, 5, 5, 61, 67, 75, 31, 76, 4, 67, 66,
+    46, 63, 77, 78, 79, 80, 63, 5, 61, 67, 5, 81, 52, 53, 82, 83,
+    46, 5, 67, 66, 46, 84, 85, 86, 53, 87, 60, 5, 61, 67, 5, 5,
+    88, 89, 53, 52, 52, 90, 91, 92, 5, 5, 67, 66, 46, 93, 94, 86,
+    53, 90, 95, 5, 61, 67, 5, 5, 96, 97, 98, 52, 99, 100, 101, 102,
+    5, 5, 67, 66, 46, 93, 94, 86, 53, 90, 95, 5, 61, 67, 5, 5,
+    5, 103, 104, 105, 106, 107, 5, 5, 5, 67, 66, 46, 93, 94, 86, 53,
+    90, 95, 5, 61, 67, 5, 5, 5, 5, 108, 7, 109, 19, 5, 5, 5,
+    5, 67, 66, 46, 93, 94, 86, 53, 90, 95, 5, 61, 67, 5, 5, 5,
+    5, 5, 110, 10, 111, 112, 96, 5, 5, 5, 5, 67, 66, 46, 93, 94,
+    113, 114, 115, 116, 16, 61, 67, 5, 5, 5, 5, 5, 59, 14, 7, 117,
+    4, 5, 5, 5, 5, 5, 67, 118, 119, 120, 121, 122, 122, 121, 120, 119,
+    118, 67, 5, 5, 5, 5, 5, 5, 123, 10, 18, 124, 12, 5, 125, 126,
+    127, 41, 5, 67, 22, 128, 129, 130, 130, 130, 130, 129, 129, 131, 67, 5,
+    41, 132, 123, 125, 5, 5, 60, 31, 10, 51, 133, 5, 5, 134, 135, 136,
+    59, 5, 67, 137, 138, 139, 139, 139, 139, 139, 139, 139, 140, 67, 5, 59,
+    17, 9, 134, 5, 5, 5, 141, 1, 0, 142, 143, 143, 144, 144, 144, 143,
+    143, 143, 13, 74, 145, 146, 146, 146, 146, 146, 146, 146, 22, 13, 143, 143,
+    143, 144, 144, 144, 143, 143, 147, 148, 149, 150, 150, 150, 150, 150, 150, 150,
+    150, 151, 85, 152, 153, 153, 153, 153, 153, 153, 153, 154, 155, 150, 150, 150,
+    150, 150, 150, 150, 150, 150, 0, 156, 157, 39, 39, 39, 39, 39, 39, 39,
+    39, 158, 159, 160, 53, 53, 53, 53, 53, 53, 53, 161, 18, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 148, 162, 163, 163, 163, 163, 163, 163, 163, 163,
+    164, 165, 53, 53, 53, 53, 53, 53, 53, 53, 53, 166, 163, 163, 163, 163,
+    163, 163, 163, 163, 163, 167, 168, 169, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 170, 171, 171, 172, 173, 174, 174, 174, 174, 174, 174, 174, 174, 174, 175,
+    171, 176, 176, 176, 176, 176, 177, 167, 176, 176, 176, 176, 176, 2, 1, 1,
+    1, 1, 1, 1, 3, 1, 1, 1, 5, 1, 1, 1, 1, 6, 7, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 9, 10, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1,
+    0, 1, 1, 1, 1, 4, 11, 1, 1, 1, 1, 1, 1, 1, 1, 3,
+    3, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 12, 1, 1, 1, 0, 0, 1, 1, 1, 12, 1, 1,
+    1, 1, 0, 3, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 3, 13, 10, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 14, 0,
+    1, 15, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 10, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 2, 5, 1, 1, 1, 1, 1, 1,
+    0, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 16, 1,
+    1, 1, 2, 3, 4, 3, 5, 4, 0, 6, 4, 4, 4, 6, 6, 4,
+    4, 0, 4, 4, 1, 1, 4, 4, 0, 2, 4, 4, 4, 4, 2, 2,
+    7, 7, 4, 8, 4, 4, 8, 6, 2, 7, 2, 9, 1, 2, 10, 4,
+    2, 11, 5, 2, 4, 2, 7, 4, 2, 5, 4, 2, 11, 2, 6, 1,
+    6, 2, 7, 1, 2, 6, 2, 1, 7, 1, 1, 2, 2, 2, 2, 1,
+    1, 7, 12, 4, 4, 4, 4, 1, 2, 7, 2, 2, 7, 2, 4, 4,
+    4, 4, 1, 7, 7, 7, 2, 13, 11, 2, 1, 7, 4, 4, 7, 11,
+    2, 4, 13, 11, 7, 7, 7, 7, 7, 7, 2, 11, 11, 11, 11, 11,
+    11, 2, 1, 1, 1, 1, 11, 11, 4, 1, 1, 1, 1, 1, 1, 4,
+    7, 7, 7, 4, 2, 2, 4, 4, 4, 1, 1, 1, 1, 4, 1, 10,
+    2, 11, 10, 4, 4, 1, 1, 1, 1, 4, 4, 4, 2, 2, 1, 12,
+    1, 1, 12, 1, 1, 11, 11, 11, 11, 2, 4, 5, 0, 1, 2, 11,
+    11, 11, 11, 1, 11, 12, 1, 1, 12, 10, 2, 1, 1, 1, 1, 1,
+    4, 6, 11, 11, 11, 11, 2, 4, 1, 1, 1, 1, 1, 11, 10, 2,
+    1, 11, 11, 11, 11, 1, 2, 7, 1, 1, 1, 1, 1, 1, 7, 2,
+    3, 4, 5, 5, 4, 3, 2, 1, 2, 6, 4, 7, 7, 4, 6, 2,
+    2, 2, 2, 9, 4, 7, 7, 4, 9, 2, 10, 2, 2, 9, 4, 7,
+    7, 4, 9, 2, 2, 2, 11, 2, 1, 1, 2, 11, 2, 12, 13, 1,
+    4, 1, 7, 7, 1, 4, 1, 13, 12, 14, 15, 0, 4, 8, 16, 16,
+    8, 4, 0, 15, 14, 2, 2, 17, 8, 18, 18, 8, 17, 2, 2, 2,
+    2, 17, 10, 19, 14, 20, 21, 10, 17, 2, 2, 15, 15, 2, 2, 15,
+    22, 2, 2, 2, 2, 15, 15, 13, 22, 23, 23, 22, 24, 2, 2, 23,
+    23, 22, 13, 11, 2, 23, 23, 2, 23, 25, 22, 23, 23, 2, 11, 2,
+    2, 2, 2, 5, 25, 26, 27, 2, 2, 2, 2, 18, 28, 15, 1, 29,
+    19, 0, 0, 19, 29, 1, 15, 28, 18, 2, 2, 22, 15, 0, 29, 29,
+    29, 29, 29, 29, 0, 15, 22, 2, 2, 5, 8, 2, 2, 2, 2, 2,
+    17, 8, 1, 1, 8, 17, 2, 2, 2, 2, 2, 16, 30, 2, 2, 2,
+    2, 2, 2, 31, 29, 1, 0, 0, 1, 29, 31, 2, 10, 2, 2, 2,
+    2, 30, 16, 32, 23, 2, 2, 2, 2, 1, 29, 1, 1, 1, 1, 29,
+    1, 2, 2, 2, 10, 23, 32, 16, 2, 12, 23, 2, 2, 8, 8, 8,
+    8, 2, 2, 23, 12, 2, 16, 30, 11, 33, 23, 23, 12, 2, 2, 2,
+    1, 8, 8, 8, 8, 1, 2, 2, 2, 12, 23, 23, 33, 11, 30, 2,
+    2, 2, 23, 23, 23, 12, 10, 9, 29, 8, 8, 29, 9, 2, 12, 23,
+    23, 23, 2, 10, 2, 2, 2, 23, 17, 2, 2, 15, 34, 29, 8, 8,
+    29, 34, 15, 2, 2, 17, 23, 2, 2, 2, 2, 23, 2, 2, 15, 35,
+    8, 8, 8, 8, 35, 15, 2, 2, 23, 2, 2, 2, 2, 15, 15, 2,
+    6, 3, 8, 8, 3, 6, 2, 15, 15, 2, 2, 2, 22, 22, 2, 3,
+    1, 8, 8, 1, 3, 2, 22, 22, 10, 1, 10, 23, 23, 2, 8, 8,
+    8, 8, 2, 23, 23, 2, 16, 30, 12, 11, 11, 11, 11, 12, 30, 2,
+    36, 35, 35, 14, 2, 36, 24, 24, 36, 0, 1, 1, 1, 2, 3, 4,
+    5, 1, 6, 1, 1, 1, 1, 1, 7, 7, 7, 7, 3, 3, 3, 4,
+    1, 1, 1, 8, 9, 10, 11, 12, 13, 14, 15, 7, 7, 7, 16, 4,
+    1, 17, 18, 19, 20, 20, 20, 12, 12, 12, 12, 21, 22, 7, 16, 4,
+    1, 23, 20, 20, 20, 20, 20, 12, 12, 12, 12, 12, 24, 7, 16, 25,
+    1, 23, 20, 20, 20, 20, 20, 12, 12, 12, 12, 12, 26, 7, 1, 6,
+    1, 20, 20, 20, 20, 20, 12, 12, 12, 12, 12, 27, 2, 1, 1, 28,
+    20, 20, 20, 20, 12, 12, 12, 12, 29, 7, 3, 6, 1, 10, 20, 20,
+    20, 20, 12, 12, 12, 12, 13, 7, 3, 1, 1, 30, 20, 20, 20, 20,
+    12, 12, 12, 12, 31, 7, 4, 1, 1, 32, 20, 20, 20, 12, 12, 12,
+    33, 7, 2, 6, 1, 17, 28, 20, 20, 12, 12, 29, 34, 7, 4, 1,
+    1, 23, 35, 20, 12, 29, 36, 7, 3, 1, 1, 37, 38, 39, 40, 7,
+    3, 25, 1, 1, 1, 7, 7, 3, 41, 2, 4, 0, 0, 4, 1, 0,
+    5, 6, 1, 0, 0, 4, 4, 4, 0, 1, 7, 0, 0, 0, 8, 6,
+    0, 0, 0, 1, 5, 10, 11, 0, 0, 0, 0, 1, 0, 10, 12, 13,
+    10, 1, 0, 0, 6, 10, 13, 10, 2, 13, 13, 13, 13, 1, 0, 0,
+    14, 13, 13, 10, 15, 13, 10, 2, 1, 0, 0, 16, 17, 13, 10, 13,
+    18, 2, 19, 0, 20, 2, 21, 13, 10, 13, 22, 2, 23, 0, 19, 24,
+    25, 26, 13, 10, 18, 2, 19, 0, 0, 27, 28, 13, 29, 30, 31, 32,
+    0, 0, 33, 34, 6, 0, 0, 15};
+
+// boss_ship_palette: 15 colours
+constexpr uint16_t boss_ship_palette[] = {
+    0xae73, 0x0c63, 0x1084, 0x2c63, 0x6d6b, 0x8e73, 0x3084, 0xf7bd,
+    0x55ad, 0xcf7b, 0xf39c, 0x8aea, 0x14a5, 0x8dcb, 0x6dd3};
+
+// boss_ship: 48x48, opaque 44x44 at (2, 3), 73 runs
+constexpr uint16_t boss_ship_rows[] = {
+    0, 1, 2, 3, 4, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 24, 27, 30, 33,
+    36, 39, 42, 45, 48, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 58, 61, 62, 63, 67, 71, 73};
+constexpr SpriteRun boss_ship_runs[] = {
+    {18, 8, 0}, {18, 9, 8}, {17, 10, 17}, {16, 12, 27},
+    {13, 2, 2}, {16, 12, 39}, {29, 2, 2}, {13, 18, 51},
+    {13, 18, 69}, {13, 18, 87}, {13, 18, 105}, {13, 18, 123},
+    {13, 18, 141}, {12, 20, 159}, {12, 20, 179}, {12, 20, 199},
+    {12, 20, 179}, {12, 20, 219}, {13, 18, 180}, {13, 18, 239},
+    {14, 16, 181}, {0, 2, 0}, {14, 16, 257}, {42, 2, 0},
+    {0, 2, 0}, {15, 15, 273}, {42, 2, 0}, {0, 2, 0},
+    {15, 14, 288}, {42, 2, 0}, {0, 2, 0}, {15, 14, 302},
+    {42, 2, 0}, {0, 2, 0}, {16, 12, 316}, {42, 2, 0},
+    {0, 2, 0}, {16, 12, 328}, {42, 2, 0}, {0, 2, 0},
+    {13, 18, 340}, {42, 2, 0}, {0, 2, 0}, {13, 18, 358},
+    {42, 2, 0}, {0, 2, 0}, {13, 18, 376}, {42, 2, 0},
+    {0, 44, 394}, {0, 44, 394}, {0, 44, 438}, {0, 44, 438},
+    {0, 44, 394}, {0, 44, 394}, {0, 44, 438}, {0, 44, 438},
+    {0, 44, 394}, {0, 44, 482}, {0, 2, 0}, {13, 18, 358},
+    {42, 2, 0}, {13, 18, 358}, {13, 18, 358}, {13, 3, 2},
+    {18, 3, 2}, {23, 3, 2}, {28, 3, 2}, {13, 3, 2},
+    {18, 3, 2}, {23, 3, 2}, {28, 3, 2}, {18, 3, 2},
+    {23, 3, 2}};
+
+// bullet_sprite_palette: 27 colours
+constexpr uint16_t bullet_sprite_palette[] = {
+    0x4229, 0x0031, 0x4529, 0x279c, 0xa1a3, 0x8a52, 0xe1f5, 0x01fe,
+    0xe061, 0x508c, 0x02f6, 0xe092, 0xf5c5, 0x02fe, 0x00cc, 0xc639,
+    0xe049, 0xe051, 0x4039, 0x0cad, 0x41c5, 0x40c5, 0x20b4, 0x31f7,
+    0xe2fe, 0xe1fe, 0xc0fd};
+
+// bullet_sprite: 4x8, opaque 4x8 at (0, 0), 8 runs
+constexpr uint16_t bullet_sprite_rows[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8};
+constexpr SpriteRun bullet_sprite_runs[] = {
+    {1, 2, 1}, {0, 4, 526}, {0, 4, 530}, {0, 4, 534},
+    {0, 4, 538}, {0, 4, 542}, {0, 4, 546}, {0, 4, 550}};
+
+// enemy_ship_palette: 97 colours
+constexpr uint16_t enemy_ship_palette[] = {
+    0x4531, 0x0529, 0x8749, 0x2529, 0x0421, 0xc861, 0xa829, 0x2b32,
+    0x2521, 0xe318, 0xcf32, 0x313b, 0xe420, 0x6721, 0xae32, 0x4b32,
+    0x2421, 0x8729, 0xce32, 0x4521, 0xf032, 0x4529, 0x8d32, 0xe931,
+    0x8631, 0x0932, 0x0040, 0xe320, 0x0429, 0x6629, 0x9063, 0xb063,
+    0x8629, 0xa759, 0x0842, 0x7063, 0x8651, 0xa228, 0x4a8a, 0xf073,
+    0xb7a5, 0xa731, 0x317c, 0x097a, 0x2531, 0xc328, 0x4329, 0x4431,
+    0x6529, 0x2429, 0x4a82, 0xd38c, 0x4c32, 0x3595, 0x0972, 0x4539,
+    0x2329, 0xe4e5, 0x4429, 0x1074, 0x6531, 0x7ab6, 0xc831, 0xf03a,
+    0xbcbe, 0x8639, 0xaf6b, 0x04ee, 0x6431, 0x3ecf, 0xfcc6, 0x7fd7,
+    0xfdc6, 0xd48c, 0xef32, 0x5ecf, 0x1dcf, 0xf9ad, 0xa631, 0x6c32,
+    0x6d32, 0x4629, 0x4942, 0xc929, 0xa441, 0x9384, 0xec52, 0xe831,
+    0xec5a, 0x19ae, 0x494a, 0xa729, 0xc493, 0x447b, 0x8a4a, 0x8431,
+    0xab52};
+
+// enemy_ship: 24x24, opaque 24x24 at (0, 0), 33 runs
+constexpr uint16_t enemy_ship_rows[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 11, 12, 13,
+    16, 17, 18, 19, 20, 21, 22, 23, 26, 27, 29, 31,
+    33};
+constexpr SpriteRun enemy_ship_runs[] = {
+    {11, 2, 0}, {10, 4, 554}, {10, 4, 558}, {10, 5, 562},
+    {9, 6, 567}, {9, 6, 573}, {9, 6, 579}, {8, 8, 585},
+    {5, 2, 593}, {8, 8, 595}, {17, 2, 603}, {4, 16, 605},
+    {4, 17, 621}, {0, 2, 566}, {4, 17, 638}, {22, 2, 655},
+    {0, 24, 657}, {0, 24, 681}, {0, 24, 705}, {0, 24, 729},
+    {0, 24, 753}, {0, 24, 777}, {0, 24, 801}, {0, 3, 825},
+    {5, 14, 828}, {21, 3, 842}, {4, 16, 845}, {4, 11, 861},
+    {16, 4, 872}, {4, 3, 876}, {17, 3, 879}, {4, 2, 593},
+    {18, 2, 593}};
+
+// explosion_palette: 239 colours
+constexpr uint16_t explosion_palette[] = {
+    0x00f8, 0xc541, 0xe541, 0x26f5, 0x47f5, 0xc5f4, 0xc5ec, 0x02c1,
+    0x0421, 0x0842, 0x255a, 0x4529, 0x2421, 0x27f5, 0x49da, 0x69da,
+    0xe5ec, 0xa5ec, 0x674a, 0x684a, 0x6539, 0xa649, 0x6531, 0x6549,
+    0x6551, 0x8572, 0x8661, 0xa669, 0x4541, 0xcfe3, 0x10e4, 0x10dc,
+    0x69d2, 0x07f5, 0x49d2, 0xe5f4, 0xe6ec, 0x05f5, 0xe0ff, 0x84fc,
+    0x25f5, 0xaa52, 0x43a1, 0xe671, 0x2762, 0x42c9, 0x275a, 0x64a1,
+    0x00a8, 0xe318, 0x496a, 0xa651, 0x49ca, 0x28b2, 0x86ab, 0xc6ab,
+    0xe799, 0xe759, 0x8641, 0x28d2, 0x6de3, 0xe7f4, 0xefe3, 0xa9ed,
+    0x68ed, 0xe2c0, 0x8499, 0xc579, 0xa1da, 0x43b1, 0x4852, 0x80c9,
+    0x4539, 0xc789, 0x089a, 0xe781, 0xe661, 0x49c2, 0x497a, 0xc749,
+    0x89da, 0x68e3, 0x88ed, 0x6bf6, 0x06ed, 0xebf5, 0x67f5, 0xa589,
+    0xa2b9, 0x22b9, 0x81da, 0x41e3, 0x00f5, 0x01e3, 0xa491, 0x8491,
+    0x0429, 0x86dc, 0x06bc, 0x26cc, 0x28ba, 0x87f4, 0x8bf6, 0xa9f6,
+    0xcef6, 0xf2f6, 0xeaf5, 0xe581, 0xc0f4, 0x42fe, 0xeafe, 0x60f5,
+    0x83a1, 0x484a, 0x2429, 0xe789, 0xc679, 0x0583, 0xa56a, 0x86a3,
+    0xe7ec, 0x0562, 0x28a2, 0x87fd, 0xa7fd, 0x08db, 0xacf6, 0xaaf6,
+    0xeef6, 0x32f7, 0x34f7, 0x4df6, 0xe1e2, 0x22fe, 0x50ff, 0x71ff,
+    0x86fe, 0x42c1, 0x456a, 0xa6a3, 0x058b, 0x26c4, 0xc57a, 0xa441,
+    0x47fd, 0xc4f4, 0x10f7, 0xd1f6, 0x2df6, 0x63b1, 0x81e3, 0x41fe,
+    0x4fff, 0xc8fe, 0x40ec, 0x22c1, 0x4562, 0xa6e4, 0x669b, 0xc56a,
+    0xa57a, 0x27fe, 0x47ed, 0xabf6, 0x33f7, 0x6ef6, 0x46f5, 0xa499,
+    0x03b2, 0x41d2, 0xe0f4, 0x63fe, 0xa7fe, 0x01d2, 0x83b1, 0x8591,
+    0xa2b8, 0x08a2, 0x656a, 0xc6e4, 0x659b, 0xa679, 0xa7f4, 0x12f7,
+    0x0bf6, 0x8852, 0x82c9, 0x40f5, 0xc1c9, 0xe7b2, 0x46cc, 0xc6b3,
+    0xe582, 0x2593, 0xe7aa, 0xe791, 0x88e3, 0x67ec, 0xc9da, 0x4bf6,
+    0x8ff6, 0x08aa, 0x2682, 0xa671, 0x8651, 0x10fc, 0x28e3, 0xb0f6,
+    0x68f5, 0xf1f6, 0xc581, 0xe3a9, 0xe4a1, 0x8a8a, 0xeb9a, 0x8ada,
+    0xcbda, 0xa9f5, 0xe1c0, 0xc589, 0x0672, 0x4752, 0xa489, 0xa641,
+    0x085a, 0x6541, 0xa572, 0x8659, 0xc751, 0x8639, 0x4ddb, 0x08fa,
+    0x45fd, 0xe4ec, 0xcaf5, 0xe6f4, 0xc489, 0x42b9, 0x10ec};
+
+// explosion_0: 16x16, opaque 16x16 at (0, 0), 18 runs
+constexpr uint16_t explosion_0_rows[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 17, 18};
+constexpr SpriteRun explosion_0_runs[] = {
+    {8, 1, 0}, {8, 1, 263}, {6, 3, 882}, {4, 8, 885},
+    {2, 12, 893}, {3, 11, 905}, {3, 11, 916}, {2, 12, 927},
+    {2, 12, 939}, {0, 15, 951}, {2, 14, 966}, {3, 10, 980},
+    {3, 10, 990}, {4, 8, 1000}, {4, 1, 699}, {7, 2, 1008},
+    {10, 1, 1010}, {7, 1, 0}};
+
+// explosion_1: 16x16, opaque 16x16 at (0, 0), 21 runs
+constexpr uint16_t explosion_1_rows[] = {
+    0, 1, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 20, 21};
+constexpr SpriteRun explosion_1_runs[] = {
+    {7, 2, 52}, {2, 2, 533}, {7, 2, 344}, {10, 2, 537},
+    {2, 10, 1011}, {13, 2, 1021}, {0, 15, 1023}, {1, 13, 1038},
+    {1, 13, 1051}, {1, 13, 1064}, {0, 16, 1077}, {0, 16, 1093},
+    {1, 14, 1109}, {1, 14, 1123}, {1, 13, 1137}, {2, 12, 1150},
+    {1, 13, 1162}, {1, 2, 1175}, {7, 2, 344}, {10, 1, 484},
+    {7, 2, 2}};
+
+// explosion_2: 16x16, opaque 16x16 at (0, 0), 20 runs
+constexpr uint16_t explosion_2_rows[] = {
+    0, 1, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 19, 20};
+constexpr SpriteRun explosion_2_runs[] = {
+    {7, 2, 140}, {7, 2, 1087}, {10, 2, 541}, {2, 10, 1177},
+    {0, 2, 1187}, {3, 12, 1189}, {1, 13, 1201}, {2, 12, 1214},
+    {2, 12, 1226}, {0, 16, 1238}, {0, 16, 1254}, {1, 13, 1270},
+    {1, 13, 1283}, {1, 13, 1296}, {2, 12, 1309}, {2, 12, 1321},
+    {2, 1, 1333}, {7, 2, 1087}, {10, 1, 542}, {7, 2, 1219}};
+
+// explosion_3: 16x16, opaque 16x16 at (0, 0), 24 runs
+constexpr uint16_t explosion_3_rows[] = {
+    0, 1, 2, 5, 6, 8, 9, 10, 11, 12, 13, 14,
+    15, 17, 20, 22, 24};
+constexpr SpriteRun explosion_3_runs[] = {
+    {5, 2, 530}, {5, 3, 1334}, {5, 3, 1337}, {9, 2, 1340},
+    {12, 3, 1342}, {4, 11, 1345}, {0, 3, 1356}, {4, 10, 1359},
+    {0, 13, 1369}, {1, 14, 1382}, {2, 13, 1396}, {1, 13, 1409},
+    {2, 10, 1422}, {3, 10, 1432}, {2, 11, 1442}, {1, 4, 1453},
+    {6, 8, 1457}, {1, 3, 1465}, {6, 2, 1392}, {10, 5, 1468},
+    {6, 2, 1350}, {12, 4, 1473}, {6, 1, 637}, {13, 3, 1393}};
+
+// player_ship_palette: 178 colours
+constexpr uint16_t player_ship_palette[] = {
+    0x2000, 0x4108, 0x6208, 0x0d5b, 0x9fef, 0xffff, 0x4d6b, 0xa210,
+    0xfab5, 0xdbde, 0x6108, 0xe839, 0x5fe7, 0xc739, 0xe318, 0xd594,
+    0xdff7, 0x96b5, 0xc318, 0x1fdf, 0x3ce7, 0x6e6b, 0x8110, 0xb073,
+    0x35a5, 0x8310, 0xaf42, 0x2f4b, 0xc310, 0x75ad, 0x718c, 0x8210,
+    0x6010, 0x657b, 0x8010, 0x7cc6, 0x9294, 0x4e32, 0xbe85, 0x9e96,
+    0x4f4b, 0x7def, 0x2121, 0x4ade, 0xa118, 0x8631, 0x3fdf, 0x6529,
+    0x0121, 0xe128, 0x4008, 0xa731, 0xc571, 0xcafb, 0x6461, 0x4719,
+    0xfa74, 0xba85, 0xc829, 0x9ef7, 0x518c, 0xe739, 0xac52, 0xbef7,
+    0x0c63, 0xd9ad, 0xc731, 0x9ad6, 0x2842, 0xa310, 0x5cbe, 0x7ace,
+    0x55ad, 0x4110, 0x6110, 0x5def, 0x1695, 0xa220, 0x89ca, 0x08cb,
+    0xe320, 0xd7bd, 0x4441, 0x2e63, 0x308c, 0xc460, 0x4bfb, 0xa561,
+    0x8e73, 0x2341, 0x87aa, 0x6629, 0xdece, 0xaa62, 0x48a1, 0x0b63,
+    0xdfff, 0x8531, 0x67a2, 0x4359, 0xa318, 0xdaad, 0xbff7, 0xfbde,
+    0x8218, 0x2351, 0x5384, 0x7fe7, 0x14a5, 0x6b4a, 0xca5a, 0xe418,
+    0x9dc6, 0x0bfb, 0x6bfb, 0x47aa, 0xeb62, 0x58a5, 0x4521, 0x169d,
+    0xa741, 0xe578, 0x68b9, 0x59ce, 0x906b, 0xf7bd, 0x38c6, 0xd39c,
+    0x0352, 0x6552, 0xe451, 0xa110, 0xb294, 0xffd6, 0x79ce, 0xbad6,
+    0xb6b5, 0x6239, 0xe9fd, 0x4bff, 0xc439, 0x0842, 0x8729, 0x4942,
+    0x494a, 0xa351, 0x2452, 0xa631, 0x2100, 0x7653, 0xd66c, 0x2a32,
+    0x28ba, 0xc7ba, 0x8461, 0x4a32, 0x4100, 0xde74, 0xa320, 0xaad1,
+    0x8bfb, 0x29db, 0x8308, 0x8208, 0x8238, 0x8bfa, 0xe330, 0x4118,
+    0x2799, 0x2bfb, 0x469a, 0x2010, 0xcbf1, 0x2cfa, 0x2bfa, 0x0bf2,
+    0x2008, 0x2ada};
+
+// player_ship: 32x32, opaque 32x32 at (0, 0), 52 runs
+constexpr uint16_t player_ship_rows[] = {
+    0, 1, 2, 3, 4, 5, 6, 9, 12, 15, 18, 21,
+    24, 27, 30, 33, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52};
+constexpr SpriteRun player_ship_runs[] = {
+    {14, 4, 1477}, {13, 6, 1481}, {13, 6, 1487}, {13, 6, 1493},
+    {12, 8, 1499}, {12, 8, 1507}, {4, 3, 1515}, {11, 10, 1518},
+    {25, 3, 1515}, {4, 3, 1528}, {11, 10, 1531}, {25, 3, 1541},
+    {4, 3, 651}, {11, 10, 1544}, {25, 3, 1554}, {4, 3, 1557},
+    {11, 10, 1560}, {25, 3, 1570}, {4, 3, 1028}, {11, 10, 1573},
+    {25, 3, 1583}, {4, 3, 1028}, {10, 12, 1586}, {25, 3, 1583},
+    {4, 3, 1028}, {9, 14, 1598}, {25, 3, 1583}, {4, 3, 1028},
+    {8, 16, 1612}, {25, 3, 1583}, {4, 3, 1028}, {8, 16, 1628},
+    {25, 3, 1583}, {4, 3, 1028}, {8, 16, 1644}, {25, 3, 1583},
+    {4, 24, 1660}, {4, 24, 1684}, {4, 24, 1708}, {5, 22, 1732},
+    {3, 26, 1754}, {3, 26, 1780}, {2, 28, 1806}, {1, 30, 1834},
+    {0, 32, 1864}, {0, 31, 1896}, {0, 32, 1927}, {0, 32, 1959},
+    {1, 30, 1991}, {9, 14, 2021}, {9, 14, 2035}, {10, 12, 2049}};
+
+// player_ship_blue_palette: 17 colours
+constexpr uint16_t player_ship_blue_palette[] = {
+    0x7c24, 0x5c24, 0x1f04, 0x5f05, 0x5d1c, 0x3c24, 0x7b24, 0x3c1c,
+    0x7c1c, 0xbd2c, 0x7d24, 0x1c1c, 0x5d24, 0xdf34, 0xff07, 0x5c1c,
+    0x3c2c};
+
+// player_ship_blue: 32x32, opaque 32x32 at (0, 0), 50 runs
+constexpr uint16_t player_ship_blue_rows[] = {
+    0, 2, 4, 6, 8, 10, 12, 13, 14, 15, 16, 17,
+    19, 21, 23, 25, 26, 27, 28, 29, 31, 34, 35, 36,
+    37, 38, 40, 41, 44, 45, 48, 49, 50};
+constexpr SpriteRun player_ship_blue_runs[] = {
+    {12, 3, 1}, {17, 3, 4}, {11, 4, 2061}, {17, 4, 2065},
+    {11, 4, 66}, {17, 4, 2069}, {11, 4, 1}, {17, 4, 3},
+    {11, 4, 2}, {17, 4, 2}, {11, 4, 2}, {17, 4, 2},
+    {11, 10, 2073}, {11, 10, 2083}, {10, 12, 2093}, {10, 12, 2105},
+    {10, 12, 2117}, {10, 5, 2062}, {17, 5, 2062}, {10, 5, 2062},
+    {17, 5, 2129}, {10, 5, 2134}, {17, 5, 2089}, {11, 4, 2},
+    {17, 4, 2}, {11, 10, 2139}, {11, 10, 2079}, {11, 10, 2149},
+    {6, 20, 2159}, {5, 10, 2179}, {17, 10, 2189}, {0, 3, 4},
+    {4, 24, 2199}, {29, 3, 2223}, {0, 32, 2226}, {0, 32, 2258},
+    {0, 32, 2290}, {0, 32, 2259}, {0, 15, 2226}, {17, 15, 2243},
+    {0, 32, 2322}, {0, 3, 1}, {5, 23, 2354}, {29, 3, 4},
+    {5, 22, 2377}, {6, 6, 2112}, {13, 6, 2114}, {20, 6, 2062},
+    {13, 6, 2062}, {13, 6, 1}};
+
+// player_ship_green_palette: 14 colours
+constexpr uint16_t player_ship_green_palette[] = {
+    0xca45, 0xea45, 0x0a46, 0x4b4e, 0x0a3e, 0x293e, 0x0b3e, 0xeb45,
+    0x6c36, 0xf007, 0xe007, 0x0b46, 0x2a46, 0x4a55};
+
+// player_ship_green: 32x32, opaque 30x30 at (1, 1), 78 runs
+constexpr uint16_t player_ship_green_rows[] = {
+    0, 1, 2, 3, 5, 6, 7, 9, 11, 13, 16, 19,
+    21, 23, 25, 28, 31, 34, 37, 42, 49, 56, 61, 66,
+    69, 72, 74, 75, 76, 77, 78};
+constexpr SpriteRun player_ship_green_runs[] = {
+    {13, 4, 1}, {13, 4, 2399}, {12, 6, 2403}, {12, 2, 2409},
+    {16, 2, 66}, {12, 6, 2411}, {11, 8, 2417}, {11, 2, 105},
+    {17, 2, 66}, {11, 2, 1219}, {17, 2, 2425}, {11, 2, 561},
+    {17, 2, 52}, {10, 2, 2078}, {13, 4, 2427}, {18, 2, 2431},
+    {10, 2, 2433}, {13, 4, 2435}, {18, 2, 66}, {10, 2, 2439},
+    {18, 2, 2}, {10, 2, 2425}, {18, 2, 2061}, {10, 2, 555},
+    {18, 2, 2441}, {10, 2, 2441}, {13, 4, 2443}, {18, 2, 263},
+    {10, 2, 2441}, {13, 4, 2399}, {18, 2, 263}, {10, 2, 2441},
+    {13, 4, 263}, {18, 2, 263}, {5, 7, 2447}, {13, 4, 263},
+    {18, 7, 2454}, {5, 1, 16}, {7, 5, 2461}, {13, 4, 263},
+    {18, 5, 2466}, {24, 1, 16}, {0, 6, 2471}, {7, 2, 555},
+    {10, 2, 2441}, {13, 4, 263}, {18, 2, 263}, {21, 2, 2439},
+    {24, 6, 2477}, {0, 6, 2483}, {7, 1, 16}, {10, 2, 2441},
+    {13, 4, 2489}, {18, 2, 263}, {22, 1, 16}, {24, 6, 2493},
+    {0, 8, 2499}, {10, 2, 2441}, {13, 4, 2507}, {18, 2, 263},
+    {22, 8, 2511}, {0, 4, 263}, {10, 2, 2409}, {13, 4, 263},
+    {18, 2, 2076}, {26, 4, 263}, {0, 12, 2519}, {13, 4, 2531},
+    {18, 12, 2535}, {0, 12, 2547}, {13, 4, 2559}, {18, 12, 2563},
+    {0, 13, 2575}, {17, 13, 2588}, {4, 22, 2601}, {11, 8, 2079},
+    {11, 8, 2623}, {11, 8, 2631}};
+
+// player_ship_red_palette: 37 colours
+constexpr uint16_t player_ship_red_palette[] = {
+    0x4d6b, 0x2c63, 0x0c63, 0xef7b, 0xf39c, 0x2842, 0xb294, 0x694a,
+    0x0842, 0x518c, 0xeb5a, 0xcba2, 0xeb82, 0xaad2, 0xeb9a, 0x8aea,
+    0xaa52, 0xaaca, 0x6d6b, 0x8a52, 0xebaa, 0x699a, 0xeb92, 0xcac2,
+    0xcbaa, 0xeb72, 0xeb6a, 0x698a, 0xcb92, 0xae73, 0xcb5a, 0xebb2,
+    0x8a82, 0xcbb2, 0x10a4, 0xaab2, 0xcb9a};
+
+// player_ship_red: 32x32, opaque 24x32 at (4, 0), 57 runs
+constexpr uint16_t player_ship_red_rows[] = {
+    0, 2, 4, 5, 6, 9, 10, 11, 14, 15, 16, 19,
+    20, 21, 22, 23, 24, 27, 30, 35, 36, 39, 44, 45,
+    46, 47, 48, 49, 50, 51, 53, 55, 57};
+constexpr SpriteRun player_ship_red_runs[] = {
+    {8, 2, 1}, {14, 2, 5}, {8, 2, 555}, {14, 2, 555},
+    {8, 8, 2639}, {7, 10, 2647}, {7, 3, 2475}, {11, 2, 1021},
+    {14, 3, 2475}, {7, 10, 2657}, {7, 10, 2667}, {6, 4, 2677},
+    {11, 2, 1021}, {14, 4, 2681}, {6, 12, 2685}, {6, 12, 2697},
+    {6, 3, 2709}, {10, 4, 2712}, {15, 3, 2716}, {6, 12, 2719},
+    {6, 12, 2731}, {6, 12, 2743}, {6, 12, 2755}, {6, 12, 2767},
+    {0, 2, 1021}, {5, 14, 2779}, {22, 2, 1021}, {0, 2, 1021},
+    {4, 16, 2793}, {22, 2, 1021}, {0, 2, 2809}, {3, 6, 2811},
+    {10, 4, 2817}, {15, 6, 2821}, {22, 2, 338}, {0, 24, 2827},
+    {0, 5, 2851}, {7, 10, 2856}, {19, 5, 2866}, {0, 6, 2871},
+    {7, 2, 2559}, {10, 4, 2877}, {15, 2, 555}, {18, 6, 2881},
+    {0, 24, 2887}, {1, 22, 2911}, {2, 20, 2933}, {3, 18, 2953},
+    {4, 16, 2971}, {5, 14, 2987}, {5, 14, 3001}, {6, 4, 3015},
+    {14, 4, 3019}, {7, 3, 3023}, {14, 3, 3026}, {8, 2, 3029},
+    {14, 2, 3031}};
+
+// powerup_shield_palette: 42 colours
+constexpr uint16_t powerup_shield_palette[] = {
+    0x1ce7, 0x3ce7, 0xbbd6, 0xdbde, 0xfbde, 0xbad6, 0x5def, 0x9bd6,
+    0x1cdf, 0x9d9e, 0x1d56, 0x9d15, 0xbf04, 0x1e1d, 0xbd5d, 0x7bbe,
+    0x7bce, 0x1cd7, 0xdd3d, 0x7d05, 0x5d05, 0xff0c, 0x5bae, 0xfcc6,
+    0x3c96, 0xffff, 0x3b9e, 0x9bc6, 0x9d1d, 0xdf04, 0xdcb6, 0x1c86,
+    0xfd45, 0xfe14, 0x7bb6, 0xbd25, 0x3c9e, 0x3cdf, 0x1d5e, 0x3e25,
+    0x7bc6, 0xbfd6};
+
+// powerup_shield: 16x16, opaque 16x16 at (0, 0), 16 runs
+constexpr uint16_t powerup_shield_rows[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16};
+constexpr SpriteRun powerup_shield_runs[] = {
+    {4, 8, 3033}, {1, 14, 3041}, {0, 16, 3055}, {0, 16, 3071},
+    {0, 16, 3087}, {0, 16, 3103}, {1, 14, 3119}, {1, 14, 3133},
+    {1, 14, 3147}, {1, 14, 3161}, {2, 12, 3175}, {2, 12, 3187},
+    {3, 10, 3199}, {4, 8, 3209}, {4, 8, 3217}, {6, 4, 2400}};
+
+// powerup_weapon_palette: 35 colours
+constexpr uint16_t powerup_weapon_palette[] = {
+    0xbf65, 0xbf5d, 0xe6fd, 0x05fe, 0xdf5d, 0xe5fd, 0xdf65, 0x5f55,
+    0x7f65, 0x9f65, 0x971e, 0xd626, 0x9716, 0x771e, 0xff65, 0xff07,
+    0x0be6, 0x543e, 0x5076, 0xd88d, 0xbe65, 0x08de, 0x2bb6, 0xf1bd,
+    0x06fe, 0x07e6, 0x7536, 0x07fe, 0x2ac6, 0xb52e, 0x308e, 0xeadd,
+    0xd98d, 0xebdd, 0x0abe};
+
+// powerup_weapon: 16x16, opaque 12x14 at (2, 1), 22 runs
+constexpr uint16_t powerup_weapon_rows[] = {
+    0, 2, 5, 6, 8, 11, 13, 15, 16, 17, 18, 19,
+    20, 21, 22};
+constexpr SpriteRun powerup_weapon_runs[] = {
+    {2, 2, 1}, {7, 1, 16}, {1, 4, 6}, {7, 1, 27},
+    {9, 2, 2}, {0, 12, 3225}, {0, 1, 16}, {2, 10, 3237},
+    {0, 1, 16}, {3, 5, 3247}, {9, 3, 2443}, {0, 10, 3252},
+    {11, 1, 27}, {0, 3, 3262}, {4, 8, 3265}, {0, 12, 3273},
+    {1, 10, 3285}, {1, 10, 3295}, {1, 10, 3305}, {1, 10, 3315},
+    {2, 7, 3325}, {4, 4, 3332}};
+
+constexpr RunSprite boss_ship = {48, 48, 2, 3, 44, 44, boss_ship_rows, boss_ship_runs, sprites_pixels, boss_ship_palette};
+constexpr RunSprite bullet_sprite = {4, 8, 0, 0, 4, 8, bullet_sprite_rows, bullet_sprite_runs, sprites_pixels, bullet_sprite_palette};
+constexpr RunSprite enemy_ship = {24, 24, 0, 0, 24, 24, enemy_ship_rows, enemy_ship_runs, sprites_pixels, enemy_ship_palette};
+constexpr RunSprite explosion[4] = {
+    {16, 16, 0, 0, 16, 16, explosion_0_rows, explosion_0_runs, sprites_pixels, explosion_palette},
+    {16, 16, 0, 0, 16, 16, explosion_1_rows, explosion_1_runs, sprites_pixels, explosion_palette},
+    {16, 16, 0, 0, 16, 16, explosion_2_rows, explosion_2_runs, sprites_pixels, explosion_palette},
+    {16, 16, 0, 0, 16, 16, explosion_3_rows, explosion_3_runs, sprites_pixels, explosion_palette}};
+constexpr RunSprite player_ship = {32, 32, 0, 0, 32, 32, player_ship_rows, player_ship_runs, sprites_pixels, player_ship_palette};
+constexpr RunSprite player_ship_blue = {32, 32, 0, 0, 32, 32, player_ship_blue_rows, player_ship_blue_runs, sprites_pixels, player_ship_blue_palette};
+constexpr RunSprite player_ship_green = {32, 32, 1, 1, 30, 30, player_ship_green_rows, player_ship_green_runs, sprites_pixels, player_ship_green_palette};
+constexpr RunSprite player_ship_red = {32, 32, 4, 0, 24, 32, player_ship_red_rows, player_ship_red_runs, sprites_pixels, player_ship_red_palette};
+constexpr RunSprite powerup_shield = {16, 16, 0, 0, 16, 16, powerup_shield_rows, powerup_shield_runs, sprites_pixels, powerup_shield_palette};
+constexpr RunSprite powerup_weapon = {16, 16, 2, 1, 12, 14, powerup_weapon_rows, powerup_weapon_runs, sprites_pixels, powerup_weapon_palette};
+
+#endif
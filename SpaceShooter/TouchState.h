@@ -0,0 +1,37 @@
+#ifndef TOUCH_STATE_H
+#define TOUCH_STATE_H
+
+#include <stdint.h>
+
+// FT6336 registers read in one burst: TD_STATUS (0x02), then six bytes per
+// touch point (XH, XL, YH, YL, weight, misc) for both points
+#define FT6336_REG_STATUS 0x02
+#define FT6336_BURST_LEN 13
+#define FT6336_MAX_POINTS 2
+
+// One touch reading, in panel coordinates
+struct TouchState {
+  uint8_t touches; // Points down, 0-2
+  uint16_t x[FT6336_MAX_POINTS];
+  uint16_t y[FT6336_MAX_POINTS];
+  uint32_t time; // micros() of the INT edge that triggered the read
+  uint32_t seq;  // Readings since boot
+};
+
+// Decodes a burst read starting at TD_STATUS. time and seq are left for
+// the caller. Only <stdint.h>, so it also builds on a host.
+inline TouchState decodeTouch(const uint8_t regs[FT6336_BURST_LEN]) {
+  TouchState state = {};
+  uint8_t touches = regs[0] & 0x0F;
+  if (touches > FT6336_MAX_POINTS)
+    return state; // 0x0F until the first scan after reset
+  for (int i = 0; i < touches; i++) {
+    const uint8_t *p = regs + 1 + i * 6;
+    state.x[i] = ((p[0] & 0x0F) << 8) | p[1];
+    state.y[i] = ((p[2] & 0x0F) << 8) | p[3];
+  }
+  state.touches = touches;
+  return state;
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <stdint.h>
+
+// Lock-free handoff of the latest value from one writer to one reader.
+//
+// Three slots: the writer owns back(), the reader owns front() and the third
+// sits in between. publish() swaps the filled back slot with the middle one
+// and flags it fresh; acquire() swaps the middle slot with the front one if
+// it is fresh. Neither side ever waits, the reader always sees a complete
+// value and values published faster than they are read are dropped.
+//
+// The slot handed back to the writer holds an older value, so the writer
+// must overwrite all of it before publishing again.
+//
+// Only <atomic>, so it also builds on a host (e.g. with std::thread).
+template <typename T> class TripleBuffer {
+public:
+  // Slots start value-initialized, so front() reads as zero (or T()) until
+  // the first publish
+  TripleBuffer() : _slots(), _back(0), _middle(1), _front(2) {}
+
+  // Writer side
+  T &back() { return _slots[_back]; }
+  void publish() {
+    uint32_t old = _middle.exchange(_back | FRESH, std::memory_order_acq_rel);
+    _back = old & INDEX;
+  }
+
+  // Reader side: true if a newer value was published since the last call.
+  // front() stays valid until the next acquire().
+  bool acquire() {
+    if (!(_middle.load(std::memory_order_relaxed) & FRESH))
+      return false;
+    uint32_t old = _middle.exchange(_front, std::memory_order_acq_rel);
+    _front = old & INDEX;
+    return true;
+  }
+  const T &front() const { return _slots[_front]; }
+
+private:
+  static const uint32_t INDEX = 3;
+  static const uint32_t FRESH = 4;
+
+  T _slots[3];
+  uint32_t _back;                // Writer only
+  std::atomic<uint32_t> _middle; // Slot index | FRESH
+  uint32_t _front;               // Reader only
+};
+
+#endif
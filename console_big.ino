@@ -1,5 +1,6 @@
 #define LV_CONF_INCLUDE_SIMPLE
 
+#include "JoystickSetup.h"
 #include "PacMan/Input.h"
 #include "esp_ota_ops.h"
 #include "ui.h"
@@ -769,6 +770,7 @@ void setup_ui_logic() {
 }
 
 void my_keypad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
+  input.poll(); // Eventos del muestreador desde la última lectura
   JoystickInput joy = input.getJoystick();
   ButtonInput btn = input.getButtons();
 
@@ -1061,6 +1063,8 @@ void setup() {
 
   // 3. Componentes
   initTouch();
+  if (!digitalRead(BUTTON_A_PIN) && !digitalRead(BUTTON_B_PIN))
+    calibrateJoystick(tft, input); // A+B mantenidos al arrancar
   initLVGL();
 
   Serial.println("Memoria libre: " + String(ESP.getFreeHeap()) + " bytes");
@@ -0,0 +1,49 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <chrono>
+#include <cstdio>
+
+// Minimal checks for the host tests: CHECK reports and carries on, and
+// main() returns hostTestResult() so ctest sees the failures.
+
+inline int &hostTestFailures() {
+  static int failures = 0;
+  return failures;
+}
+
+#define CHECK(cond)                                                            \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);          \
+      hostTestFailures()++;                                                    \
+    }                                                                          \
+  } while (0)
+
+#define CHECK_EQ(a, b)                                                         \
+  do {                                                                         \
+    long long va_ = (long long)(a), vb_ = (long long)(b);                      \
+    if (va_ != vb_) {                                                          \
+      printf("%s:%d: CHECK_EQ failed: %s = %lld, %s = %lld\n", __FILE__,       \
+             __LINE__, #a, va_, #b, vb_);                                      \
+      hostTestFailures()++;                                                    \
+    }                                                                          \
+  } while (0)
+
+inline int hostTestResult() {
+  int failures = hostTestFailures();
+  printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+  return failures ? 1 : 0;
+}
+
+// Wall-clock microseconds per call of fn, over n calls
+template <typename F> double benchmarkUs(int n, F fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; i++)
+    fn();
+  std::chrono::duration<double, std::micro> us =
+      std::chrono::steady_clock::now() - start;
+  return us.count() / n;
+}
+
+#endif
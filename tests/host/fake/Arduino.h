@@ -0,0 +1,122 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Host stand-in for the Arduino-ESP32 core: only what the games use. Time,
+// pins and the ADC are simulated and driven by tests through HostBoard.h.
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+
+using std::abs;
+using std::max;
+using std::min;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define pgm_read_byte(a) (*(const uint8_t *)(a))
+#define pgm_read_word(a) (*(const uint16_t *)(a))
+#define constrain(amt, low, high)                                              \
+  ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+uint16_t analogRead(uint8_t pin);
+void attachInterruptArg(uint8_t pin, void (*isr)(void *), void *arg,
+                        int mode);
+void detachInterrupt(uint8_t pin);
+
+void *ps_malloc(size_t size);
+bool psramFound();
+
+class String {
+public:
+  String() {}
+  String(const char *s) : _s(s ? s : "") {}
+  String(const std::string &s) : _s(s) {}
+  String(char c) : _s(1, c) {}
+  String(int v) : _s(std::to_string(v)) {}
+  String(unsigned v) : _s(std::to_string(v)) {}
+  String(long v) : _s(std::to_string(v)) {}
+  String(unsigned long v) : _s(std::to_string(v)) {}
+  String(float v, int decimals = 2) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+    _s = buf;
+  }
+
+  const char *c_str() const { return _s.c_str(); }
+  unsigned length() const { return _s.size(); }
+  String &operator+=(const String &o) {
+    _s += o._s;
+    return *this;
+  }
+  friend String operator+(const String &a, const String &b) {
+    return String(a._s + b._s);
+  }
+  bool operator==(const String &o) const { return _s == o._s; }
+  bool operator!=(const String &o) const { return _s != o._s; }
+
+private:
+  std::string _s;
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  size_t printf(const char *format, ...);
+  size_t print(const String &s) { return printf("%s", s.c_str()); }
+  size_t print(const char *s) { return printf("%s", s); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t println(const String &s) { return printf("%s\n", s.c_str()); }
+  size_t println(const char *s = "") { return printf("%s\n", s); }
+  size_t println(long v) { return printf("%ld\n", v); }
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  int available();
+  int read();
+};
+extern HardwareSerial Serial;
+
+struct EspClass {
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getFreePsram() { return 0; }
+  void restart();
+};
+extern EspClass ESP;
+
+#endif
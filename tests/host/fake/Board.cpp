@@ -0,0 +1,366 @@
+// Simulated board behind the fake Arduino, FreeRTOS, ESP-IDF, Preferences
+// and Wire headers
+
+#include "HostBoard.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <Wire.h>
+#include <esp_heap_caps.h>
+#include <esp_ota_ops.h>
+#include <condition_variable>
+#include <esp_timer.h>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace host {
+
+static Board g_board;
+static std::map<std::string, std::vector<uint8_t>> g_nvs;
+
+// Interrupt handlers by pin
+struct Isr {
+  void (*fn)(void *);
+  void *arg;
+  int mode;
+};
+static Isr g_isr[64];
+
+// A task runs on its own thread while `running`; the thread that handed
+// it control waits meanwhile
+struct Task {
+  TaskFunction_t fn;
+  void *arg;
+  uint64_t wake;     // Runs again at this time, NEVER while blocked for good
+  uint32_t notified; // Pending notifications
+  bool running;
+};
+static const uint64_t NEVER = UINT64_MAX;
+static std::vector<Task *> g_tasks;
+// Never destroyed: parked task threads wait on them until the process ends
+static std::mutex &g_taskMutex = *new std::mutex;
+static std::condition_variable &g_taskCv = *new std::condition_variable;
+static thread_local Task *t_task = nullptr; // Task on this thread, if any
+
+// Task side: hands control back until the clock reaches wake
+static void block(uint64_t wake) {
+  std::unique_lock<std::mutex> lock(g_taskMutex);
+  Task *task = t_task;
+  task->wake = wake;
+  task->running = false;
+  g_taskCv.notify_all();
+  g_taskCv.wait(lock, [task] { return task->running; });
+}
+
+// Clock side: runs a task until it blocks
+static void run(Task *task) {
+  std::unique_lock<std::mutex> lock(g_taskMutex);
+  task->running = true;
+  g_taskCv.notify_all();
+  g_taskCv.wait(lock, [task] { return !task->running; });
+}
+
+static Task *startTask(TaskFunction_t fn, void *arg) {
+  Task *task = new Task{fn, arg, g_board.now, 0, false};
+  g_tasks.push_back(task);
+  std::thread([task] {
+    t_task = task;
+    {
+      std::unique_lock<std::mutex> lock(g_taskMutex);
+      g_taskCv.wait(lock, [task] { return task->running; });
+    }
+    task->fn(task->arg);
+    block(NEVER); // Returned: parked for good
+  }).detach();
+  return task;
+}
+
+Board &board() { return g_board; }
+
+void reset() {
+  Board &b = g_board;
+  b.now = 0;
+  memset(b.pin, HIGH, sizeof(b.pin));
+  for (int i = 0; i < 64; i++)
+    b.adc[i] = 2048;
+  b.dmaHeap = 160 * 1024;
+  b.dma = true;
+  b.psram = false;
+  b.serial = getenv("HOST_SERIAL") != nullptr;
+  b.tasks = false;
+  b.input.clear();
+  b.seed = 1;
+  b.i2c.address = 0x38;
+  b.i2c.present = true;
+  memset(b.i2c.regs, 0, sizeof(b.i2c.regs));
+  b.i2c.transactions = 0;
+  b.nvsWrites = 0;
+  g_nvs.clear();
+  memset(g_isr, 0, sizeof(g_isr));
+  g_tasks.clear();
+}
+
+void advance(uint64_t us) {
+  uint64_t target = g_board.now + us;
+  if (t_task) {
+    block(target); // delay() in a task
+    return;
+  }
+  for (;;) {
+    Task *next = nullptr;
+    for (Task *task : g_tasks)
+      if (task->wake <= target && (!next || task->wake < next->wake))
+        next = task;
+    if (!next)
+      break;
+    if (next->wake > g_board.now)
+      g_board.now = next->wake;
+    run(next);
+  }
+  g_board.now = target;
+}
+
+void setPin(uint8_t pin, uint8_t level) {
+  pin &= 63;
+  uint8_t old = g_board.pin[pin];
+  g_board.pin[pin] = level;
+  const Isr &isr = g_isr[pin];
+  if (!isr.fn || old == level)
+    return;
+  if (isr.mode == CHANGE || (isr.mode == FALLING && level == LOW) ||
+      (isr.mode == RISING && level == HIGH))
+    isr.fn(isr.arg);
+}
+
+struct Init {
+  Init() { reset(); }
+} g_init;
+
+} // namespace host
+
+using host::g_board;
+
+// Arduino core
+
+HardwareSerial Serial;
+EspClass ESP;
+
+unsigned long millis() { return g_board.now / 1000; }
+unsigned long micros() { return (unsigned long)(uint32_t)g_board.now; }
+void delay(uint32_t ms) { host::advance((uint64_t)ms * 1000); }
+void delayMicroseconds(uint32_t us) { host::advance(us); }
+void yield() {}
+
+// Same sequence on every run for a given seed
+static uint32_t nextRandom() {
+  g_board.seed = g_board.seed * 1103515245u + 12345u;
+  return g_board.seed >> 1;
+}
+long random(long howbig) { return howbig > 0 ? nextRandom() % howbig : 0; }
+long random(long howsmall, long howbig) {
+  return howsmall >= howbig ? howsmall
+                            : howsmall + random(howbig - howsmall);
+}
+void randomSeed(unsigned long seed) { g_board.seed = seed; }
+
+void pinMode(uint8_t, uint8_t) {}
+int digitalRead(uint8_t pin) { return g_board.pin[pin & 63]; }
+void digitalWrite(uint8_t pin, uint8_t val) { g_board.pin[pin & 63] = val; }
+uint16_t analogRead(uint8_t pin) { return g_board.adc[pin & 63]; }
+void attachInterruptArg(uint8_t pin, void (*isr)(void *), void *arg,
+                        int mode) {
+  host::g_isr[pin & 63] = {isr, arg, mode};
+}
+void detachInterrupt(uint8_t pin) { host::g_isr[pin & 63] = {}; }
+
+void *ps_malloc(size_t size) { return g_board.psram ? malloc(size) : nullptr; }
+bool psramFound() { return g_board.psram; }
+
+size_t Print::printf(const char *format, ...) {
+  char buf[512];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (g_board.serial)
+    fputs(buf, stdout);
+  return n < 0 ? 0 : n;
+}
+
+int HardwareSerial::available() { return g_board.input.size(); }
+int HardwareSerial::read() {
+  if (g_board.input.empty())
+    return -1;
+  int c = (uint8_t)g_board.input[0];
+  g_board.input.erase(0, 1);
+  return c;
+}
+
+void EspClass::restart() { esp_restart(); }
+
+// FreeRTOS: tasks on the simulated clock when the board allows them
+
+using host::t_task;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *, uint32_t,
+                                   void *arg, UBaseType_t, TaskHandle_t *handle,
+                                   BaseType_t) {
+  host::Task *task = g_board.tasks ? host::startTask(fn, arg) : nullptr;
+  if (handle)
+    *handle = task;
+  return task ? pdPASS : pdFAIL;
+}
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack,
+                       void *arg, UBaseType_t priority, TaskHandle_t *handle) {
+  return xTaskCreatePinnedToCore(fn, name, stack, arg, priority, handle, 0);
+}
+void vTaskDelete(TaskHandle_t handle) {
+  host::Task *task = handle ? (host::Task *)handle : t_task;
+  auto &tasks = host::g_tasks;
+  tasks.erase(std::remove(tasks.begin(), tasks.end(), task), tasks.end());
+  if (task && task == t_task)
+    host::block(host::NEVER);
+}
+void vTaskDelay(TickType_t ticks) { delay(ticks); }
+void vTaskDelayUntil(TickType_t *wake, TickType_t period) {
+  *wake += period;
+  uint64_t at = (uint64_t)*wake * 1000;
+  if (at > g_board.now)
+    host::advance(at - g_board.now);
+}
+TickType_t xTaskGetTickCount() { return millis(); }
+void vTaskNotifyGiveFromISR(TaskHandle_t handle, BaseType_t *) {
+  host::Task *task = (host::Task *)handle;
+  task->notified++;
+  task->wake = min(task->wake, g_board.now);
+}
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait) {
+  host::Task *task = t_task;
+  if (!task)
+    return 0;
+  if (!task->notified && wait > 0)
+    host::block(wait == portMAX_DELAY ? host::NEVER
+                                      : g_board.now + wait * 1000ull);
+  uint32_t n = task->notified;
+  task->notified = clear || !n ? 0 : n - 1;
+  return n;
+}
+
+// ESP-IDF
+
+int64_t esp_timer_get_time() { return g_board.now; }
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+  return (caps & MALLOC_CAP_SPIRAM) ? 0 : g_board.dmaHeap;
+}
+size_t heap_caps_get_free_size(uint32_t caps) {
+  return heap_caps_get_largest_free_block(caps);
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t,
+                                                esp_partition_subtype_t,
+                                                const char *) {
+  return nullptr;
+}
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t *) {
+  return ESP_FAIL;
+}
+void esp_restart() {
+  fprintf(stderr, "esp_restart() called\n");
+  abort();
+}
+
+// Preferences
+
+bool Preferences::begin(const char *name, bool, const char *) {
+  _name = name;
+  _open = true;
+  return true;
+}
+
+bool Preferences::clear() {
+  std::string prefix = _name + "/";
+  for (auto it = host::g_nvs.begin(); it != host::g_nvs.end();) {
+    if (it->first.compare(0, prefix.size(), prefix) == 0)
+      it = host::g_nvs.erase(it);
+    else
+      ++it;
+  }
+  return _open;
+}
+
+bool Preferences::remove(const char *key) {
+  return _open && host::g_nvs.erase(_name + "/" + key) > 0;
+}
+
+bool Preferences::isKey(const char *key) {
+  return _open && host::g_nvs.count(_name + "/" + key) > 0;
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len) {
+  if (!_open)
+    return 0;
+  const uint8_t *p = (const uint8_t *)value;
+  host::g_nvs[_name + "/" + key].assign(p, p + len);
+  host::g_board.nvsWrites++;
+  return len;
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) {
+  auto it = host::g_nvs.find(_name + "/" + key);
+  if (!_open || it == host::g_nvs.end() || it->second.size() > maxLen)
+    return 0;
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+  auto it = host::g_nvs.find(_name + "/" + key);
+  return _open && it != host::g_nvs.end() ? it->second.size() : 0;
+}
+
+// Wire
+
+TwoWire Wire;
+
+static uint8_t g_i2cPointer;
+
+void TwoWire::beginTransmission(uint8_t address) {
+  _address = address;
+  _pointerSet = false;
+}
+
+size_t TwoWire::write(uint8_t data) {
+  if (!_pointerSet) {
+    g_i2cPointer = data;
+    _pointerSet = true;
+  } else {
+    g_board.i2c.regs[g_i2cPointer++] = data;
+  }
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool) {
+  host::I2cDevice &dev = g_board.i2c;
+  if (!dev.present || _address != dev.address)
+    return 2; // NACK on address
+  dev.transactions++;
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity) {
+  host::I2cDevice &dev = g_board.i2c;
+  if (!dev.present || address != dev.address)
+    return 0;
+  dev.transactions++;
+  _left = quantity;
+  return quantity;
+}
+
+int TwoWire::read() {
+  if (_left <= 0)
+    return -1;
+  _left--;
+  return g_board.i2c.regs[g_i2cPointer++];
+}
@@ -0,0 +1,55 @@
+#ifndef HOST_BOARD_H
+#define HOST_BOARD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+// Test-side controls of the simulated board behind the fake Arduino, ESP-IDF,
+// Wire and Preferences headers. Nothing runs on its own: time only moves
+// through advance(), delay() and simulated SPI transfers.
+//
+// With `tasks` set, FreeRTOS tasks created afterwards run on the simulated
+// clock, each on its own thread but never two threads at once: advance()
+// runs every task that wakes up before the new time, in order, and each
+// runs until it blocks again (vTaskDelay(Until), ulTaskNotifyTake). A
+// task's delay() blocks it the same way.
+namespace host {
+
+struct I2cDevice {
+  uint8_t address;
+  bool present;
+  uint8_t regs[256];
+  uint32_t transactions; // endTransmission() and requestFrom() calls
+};
+
+struct Board {
+  uint64_t now;       // Microseconds since boot
+  uint8_t pin[64];    // digitalRead() levels, HIGH by default (pull-ups)
+  uint16_t adc[64];   // analogRead() values, 2048 by default
+  size_t dmaHeap;     // Largest free DMA-capable block
+  bool dma;           // initDMA() result
+  bool psram;         // psramFound()
+  bool serial;        // Echo Serial output to stdout
+  bool tasks;         // Run tasks created from now on (else creation fails)
+  std::string input;  // What Serial.read() returns next
+  uint32_t seed;      // random() state
+  I2cDevice i2c;      // One device on the bus
+  uint32_t nvsWrites; // Preferences::put*() calls that stored something
+};
+
+Board &board();
+
+// Fresh board: clock at zero, pins released, stick centred, NVS empty, no
+// tasks. Tasks created before are dropped (their threads stay parked), so
+// start each test with it.
+void reset();
+
+void advance(uint64_t us);
+
+// Drives a pin, calling its interrupt handler on a matching edge
+void setPin(uint8_t pin, uint8_t level);
+
+} // namespace host
+
+#endif
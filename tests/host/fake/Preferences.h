@@ -0,0 +1,58 @@
+#ifndef PREFERENCES_H
+#define PREFERENCES_H
+
+#include <Arduino.h>
+
+// NVS held in memory for the life of the process (host::reset() clears
+// it). Every value is stored as bytes under "namespace/key".
+class Preferences {
+public:
+  Preferences() : _open(false) {}
+  ~Preferences() { end(); }
+
+  bool begin(const char *name, bool readOnly = false,
+             const char *partition = nullptr);
+  void end() { _open = false; }
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key);
+
+  size_t putBytes(const char *key, const void *value, size_t len);
+  size_t getBytes(const char *key, void *buf, size_t maxLen);
+  size_t getBytesLength(const char *key);
+
+  size_t putInt(const char *key, int32_t value) {
+    return putBytes(key, &value, sizeof(value));
+  }
+  int32_t getInt(const char *key, int32_t value = 0) {
+    getValue(key, &value, sizeof(value));
+    return value;
+  }
+  size_t putUInt(const char *key, uint32_t value) {
+    return putBytes(key, &value, sizeof(value));
+  }
+  uint32_t getUInt(const char *key, uint32_t value = 0) {
+    getValue(key, &value, sizeof(value));
+    return value;
+  }
+  size_t putBool(const char *key, bool value) {
+    uint8_t v = value;
+    return putBytes(key, &v, 1);
+  }
+  bool getBool(const char *key, bool value = false) {
+    uint8_t v = value;
+    getValue(key, &v, 1);
+    return v;
+  }
+
+private:
+  std::string _name;
+  bool _open;
+
+  void getValue(const char *key, void *value, size_t len) {
+    if (getBytesLength(key) == len)
+      getBytes(key, value, len);
+  }
+};
+
+#endif
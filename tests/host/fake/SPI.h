@@ -0,0 +1,6 @@
+#ifndef SPI_H
+#define SPI_H
+
+// TFT_eSPI owns the bus; nothing to simulate here
+
+#endif
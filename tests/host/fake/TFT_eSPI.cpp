@@ -0,0 +1,352 @@
+#include "HostBoard.h"
+#include <TFT_eSPI.h>
+
+static uint16_t swap16(uint32_t color) {
+  return (uint16_t)((color >> 8) & 0xFF) | (uint16_t)((color & 0xFF) << 8);
+}
+
+static uint32_t checksum(const uint16_t *data, uint32_t len) {
+  uint32_t h = 2166136261u;
+  for (uint32_t i = 0; i < len; i++)
+    h = (h ^ data[i]) * 16777619u;
+  return h;
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) : TFT_eSPI(Sprite()) {
+  _isSprite = false;
+  _w = w;
+  _h = h;
+  _buf = (uint16_t *)calloc((size_t)w * h, 2);
+  resetViewport();
+}
+
+TFT_eSPI::TFT_eSPI(Sprite)
+    : pushedPixels(0), pushes(0), dmaOverwrites(0), spiNsPerPixel(0),
+      _buf(nullptr), _w(0), _h(0), _vpX(0), _vpY(0), _vpW(0), _vpH(0),
+      _swap(false), _font(1), _textSize(1), _datum(TL_DATUM), _fg(0xFFFF),
+      _bg(0xFFFF), _isSprite(true), _dmaData(nullptr), _dmaX(0), _dmaY(0),
+      _dmaW(0), _dmaH(0), _dmaSum(0), _dmaDone(0), _winX(0), _winY(0),
+      _winW(0), _winH(0), _winPos(0) {}
+
+TFT_eSPI::~TFT_eSPI() {
+  if (!_isSprite)
+    free(_buf);
+}
+
+// Transfers
+
+void TFT_eSPI::transfer(uint32_t pixels) {
+  pushedPixels += pixels;
+  pushes++;
+  host::advance((uint64_t)pixels * spiNsPerPixel / 1000);
+}
+
+bool TFT_eSPI::initDMA(bool) { return host::board().dma; }
+
+bool TFT_eSPI::dmaBusy() {
+  return _dmaData && host::board().now < _dmaDone;
+}
+
+// Completes the transfer in flight. The panel gets the buffer as it is
+// now; if it changed since the push started, the real DMA would have sent
+// a mix, so that is counted.
+void TFT_eSPI::dmaWait() {
+  if (!_dmaData)
+    return;
+  if (host::board().now < _dmaDone)
+    host::board().now = _dmaDone;
+  if (checksum(_dmaData, _dmaW * _dmaH) != _dmaSum)
+    dmaOverwrites++;
+  copyIn(_dmaX, _dmaY, _dmaW, _dmaH, _dmaData, _dmaW);
+  _dmaData = nullptr;
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h,
+                            uint16_t *data, uint16_t *) {
+  dmaWait();
+  if (_swap) // As the library does, in the caller's buffer
+    for (int32_t i = 0; i < w * h; i++)
+      data[i] = swap16(data[i]);
+  _dmaData = data;
+  _dmaX = x;
+  _dmaY = y;
+  _dmaW = w;
+  _dmaH = h;
+  _dmaSum = checksum(data, w * h);
+  _dmaDone = host::board().now + (uint64_t)w * h * spiNsPerPixel / 1000;
+  pushedPixels += w * h;
+  pushes++;
+}
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+  _winX = x;
+  _winY = y;
+  _winW = w;
+  _winH = h;
+  _winPos = 0;
+  pushes++;
+}
+
+void TFT_eSPI::pushPixels(const void *data, uint32_t len) {
+  const uint16_t *src = (const uint16_t *)data;
+  for (uint32_t i = 0; i < len && _winPos < _winW * _winH; i++, _winPos++) {
+    int x = _winX + _winPos % _winW;
+    int y = _winY + _winPos / _winW;
+    if (x >= 0 && x < _w && y >= 0 && y < _h)
+      _buf[y * _w + x] = _swap ? swap16(src[i]) : src[i];
+  }
+  pushes--; // The window is the transfer
+  transfer(len);
+}
+
+void TFT_eSPI::pushBlock(int32_t x, int32_t y, int32_t w, int32_t h,
+                         const uint16_t *src, int32_t stride) {
+  copyIn(x, y, w, h, src, stride);
+  transfer(w * h);
+}
+
+void TFT_eSPI::copyIn(int32_t x, int32_t y, int32_t w, int32_t h,
+                      const uint16_t *src, int32_t stride) {
+  for (int row = 0; row < h; row++) {
+    int py = y + row;
+    if (py < 0 || py >= _h)
+      continue;
+    for (int col = 0; col < w; col++) {
+      int px = x + col;
+      if (px >= 0 && px < _w)
+        _buf[py * _w + px] = src[row * stride + col];
+    }
+  }
+}
+
+// Drawing
+
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h,
+                           bool) {
+  _vpX = max(0, x);
+  _vpY = max(0, y);
+  _vpW = min(x + w, (int32_t)_w) - _vpX;
+  _vpH = min(y + h, (int32_t)_h) - _vpY;
+}
+
+void TFT_eSPI::resetViewport() {
+  _vpX = 0;
+  _vpY = 0;
+  _vpW = _w;
+  _vpH = _h;
+}
+
+void TFT_eSPI::put(int32_t x, int32_t y, uint32_t color) {
+  if (x < 0 || y < 0 || x >= _vpW || y >= _vpH || !_buf)
+    return;
+  _buf[(_vpY + y) * _w + _vpX + x] = swap16(color);
+  if (!_isSprite)
+    pushedPixels++;
+}
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+  int32_t x = _vpX, y = _vpY, w = _vpW, h = _vpH;
+  resetViewport();
+  fillRect(0, 0, _w, _h, color);
+  setViewport(x, y, w, h);
+  if (!_isSprite)
+    pushes++;
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  put(x, y, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w,
+                             uint32_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h,
+                             uint32_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h,
+                        uint32_t color) {
+  int32_t x0 = max(x, (int32_t)0), y0 = max(y, (int32_t)0);
+  int32_t x1 = min(x + w, (int32_t)_vpW), y1 = min(y + h, (int32_t)_vpH);
+  for (int32_t py = y0; py < y1; py++)
+    for (int32_t px = x0; px < x1; px++)
+      put(px, py, color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h,
+                        uint32_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h,
+                             int32_t r, uint32_t color) {
+  r = min(r, min(w, h) / 2);
+  fillRect(x + r, y, w - 2 * r, h, color);
+  fillRect(x, y + r, w, h - 2 * r, color);
+  fillCircle(x + r, y + r, r, color);
+  fillCircle(x + w - r - 1, y + r, r, color);
+  fillCircle(x + r, y + h - r - 1, r, color);
+  fillCircle(x + w - r - 1, y + h - r - 1, r, color);
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h,
+                             int32_t r, uint32_t color) {
+  r = min(r, min(w, h) / 2);
+  drawFastHLine(x + r, y, w - 2 * r, color);
+  drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+  drawFastVLine(x, y + r, h - 2 * r, color);
+  drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+  for (int32_t dy = 0; dy <= r; dy++) {
+    int32_t dx = (int32_t)sqrtf((float)(r * r - dy * dy));
+    put(x + r - dx, y + r - dy, color);
+    put(x + w - r - 1 + dx, y + r - dy, color);
+    put(x + r - dx, y + h - r - 1 + dy, color);
+    put(x + w - r - 1 + dx, y + h - r - 1 + dy, color);
+  }
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                        uint32_t color) {
+  int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  int32_t err = dx + dy;
+  for (;;) {
+    put(x0, y0, color);
+    if (x0 == x1 && y0 == y1)
+      break;
+    int32_t e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+void TFT_eSPI::fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color) {
+  for (int32_t dy = -r; dy <= r; dy++) {
+    int32_t dx = (int32_t)sqrtf((float)(r * r - dy * dy));
+    drawFastHLine(x - dx, y + dy, 2 * dx + 1, color);
+  }
+}
+
+void TFT_eSPI::drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color) {
+  for (int32_t dy = -r; dy <= r; dy++) {
+    int32_t dx = (int32_t)sqrtf((float)(r * r - dy * dy));
+    put(x - dx, y + dy, color);
+    put(x + dx, y + dy, color);
+  }
+}
+
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                            int32_t x2, int32_t y2, uint32_t color) {
+  int32_t minX = min(x0, min(x1, x2)), maxX = max(x0, max(x1, x2));
+  int32_t minY = min(y0, min(y1, y2)), maxY = max(y0, max(y1, y2));
+  // Which side of the edge from (ax, ay) to (bx, by) the point is on
+  auto side = [](int64_t ax, int64_t ay, int64_t bx, int64_t by, int64_t px,
+                 int64_t py) {
+    return (bx - ax) * (py - ay) - (by - ay) * (px - ax);
+  };
+  for (int32_t py = minY; py <= maxY; py++) {
+    for (int32_t px = minX; px <= maxX; px++) {
+      int64_t a = side(x0, y0, x1, y1, px, py);
+      int64_t b = side(x1, y1, x2, y2, px, py);
+      int64_t c = side(x2, y2, x0, y0, px, py);
+      if ((a >= 0 && b >= 0 && c >= 0) || (a <= 0 && b <= 0 && c <= 0))
+        put(px, py, color);
+    }
+  }
+}
+
+// Text: one cell per character with a pattern that depends on the
+// character, so different strings give different pixels
+
+static int cellW(uint8_t font) { return font >= 4 ? 14 : (font == 2 ? 8 : 6); }
+static int cellH(uint8_t font) { return font >= 4 ? 26 : (font == 2 ? 16 : 8); }
+
+int16_t TFT_eSPI::textWidth(const char *text, uint8_t font) {
+  return strlen(text) * cellW(font) * _textSize;
+}
+
+int16_t TFT_eSPI::fontHeight(uint8_t font) { return cellH(font) * _textSize; }
+
+int16_t TFT_eSPI::drawString(const char *text, int32_t x, int32_t y,
+                             uint8_t font) {
+  int w = textWidth(text, font), h = fontHeight(font);
+  x -= (_datum % 3) * w / 2;
+  y -= (_datum / 3) * h / 2;
+  int cw = cellW(font) * _textSize;
+  for (int i = 0; text[i]; i++) {
+    uint8_t c = text[i];
+    for (int py = 0; py < h; py++) {
+      for (int px = 0; px < cw; px++) {
+        bool ink = px < cw - _textSize && c != ' ' &&
+                   (c * 31 + px / _textSize * 7 + py / _textSize * 13) % 3 == 0;
+        if (ink)
+          put(x + i * cw + px, y + py, _fg);
+        else if (_bg != _fg)
+          put(x + i * cw + px, y + py, _bg);
+      }
+    }
+  }
+  return w;
+}
+
+int16_t TFT_eSPI::drawCentreString(const char *text, int32_t x, int32_t y,
+                                   uint8_t font) {
+  uint8_t datum = _datum;
+  _datum = TC_DATUM;
+  int16_t w = drawString(text, x, y, font);
+  _datum = datum;
+  return w;
+}
+
+// Sprites
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft) : TFT_eSPI(Sprite()), _tft(tft) {}
+
+TFT_eSprite::~TFT_eSprite() { deleteSprite(); }
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t) {
+  deleteSprite();
+  _buf = (uint16_t *)calloc((size_t)w * h, 2);
+  if (!_buf)
+    return nullptr;
+  _w = w;
+  _h = h;
+  resetViewport();
+  return _buf;
+}
+
+void TFT_eSprite::deleteSprite() {
+  free(_buf);
+  _buf = nullptr;
+  _w = _h = 0;
+  resetViewport();
+}
+
+void TFT_eSprite::fillSprite(uint32_t color) {
+  fillRect(0, 0, _vpW, _vpH, color);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  _tft->pushBlock(x, y, _w, _h, _buf, _w);
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy,
+                             int32_t sw, int32_t sh) {
+  if (sx < 0 || sy < 0 || sw <= 0 || sh <= 0 || sx + sw > _w ||
+      sy + sh > _h)
+    return false;
+  _tft->pushBlock(tx, ty, sw, sh, _buf + sy * _w + sx, _w);
+  return true;
+}
@@ -0,0 +1,192 @@
+#ifndef TFT_ESPI_H
+#define TFT_ESPI_H
+
+#include <Arduino.h>
+
+// Host stand-in for TFT_eSPI: a 480x320 panel held in memory, 16-bit
+// sprites and the drawing calls the games make. Every buffer holds pixels
+// in panel byte order, like TFT_eSprite's 16-bit buffer, so sprite memory
+// copied by the engines lands on the panel unchanged.
+//
+// Shapes are rasterized simply and text as a pattern per character: good
+// enough to compare two ways of drawing the same frame, not a picture of
+// the real thing. Each push is counted, and with spiNsPerPixel set it also
+// takes simulated time; pushImageDMA runs in the background until
+// dmaWait() or the next DMA push.
+
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_MAROON 0x7800
+#define TFT_PURPLE 0x780F
+#define TFT_OLIVE 0x7BE0
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_DARKGREY 0x7BEF
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_CYAN 0x07FF
+#define TFT_RED 0xF800
+#define TFT_MAGENTA 0xF81F
+#define TFT_YELLOW 0xFFE0
+#define TFT_WHITE 0xFFFF
+#define TFT_ORANGE 0xFDA0
+#define TFT_PINK 0xFE19
+#define TFT_GOLD 0xFEA0
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+
+#define PSRAM_ENABLE 3
+
+#define TFT_PANEL_W 480
+#define TFT_PANEL_H 320
+
+class TFT_eSPI : public Print {
+public:
+  TFT_eSPI(int16_t w = TFT_PANEL_W, int16_t h = TFT_PANEL_H);
+  virtual ~TFT_eSPI();
+
+  void begin() {}
+  void init() {}
+  void setRotation(uint8_t) {}
+  int16_t width() const { return _w; }
+  int16_t height() const { return _h; }
+
+  // Panel transfers
+  void startWrite() {}
+  void endWrite() {}
+  bool initDMA(bool ctrl_cs = false);
+  bool dmaBusy();
+  void dmaWait();
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h,
+                    uint16_t *data, uint16_t *buffer = nullptr);
+  void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+  void pushPixels(const void *data, uint32_t len);
+  void setSwapBytes(bool swap) { _swap = swap; }
+  bool getSwapBytes() const { return _swap; }
+
+  // Drawing, relative to the viewport and clipped to it
+  void setViewport(int32_t x, int32_t y, int32_t w, int32_t h,
+                   bool vpDatum = true);
+  void resetViewport();
+  int32_t getViewportX() const { return _vpX; }
+  int32_t getViewportY() const { return _vpY; }
+  int32_t getViewportWidth() const { return _vpW; }
+  int32_t getViewportHeight() const { return _vpH; }
+
+  void fillScreen(uint32_t color);
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r,
+                     uint32_t color);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r,
+                     uint32_t color);
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                uint32_t color);
+  void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+  void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+  void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                    int32_t x2, int32_t y2, uint32_t color);
+
+  void setTextFont(uint8_t font) { _font = font; }
+  void setTextSize(uint8_t size) { _textSize = size ? size : 1; }
+  void setTextDatum(uint8_t datum) { _datum = datum; }
+  uint8_t getTextDatum() const { return _datum; }
+  void setTextColor(uint16_t fg) { _fg = _bg = fg; }
+  void setTextColor(uint16_t fg, uint16_t bg, bool bgfill = false) {
+    _fg = fg;
+    _bg = bg;
+  }
+  int16_t drawString(const char *text, int32_t x, int32_t y) {
+    return drawString(text, x, y, _font);
+  }
+  int16_t drawString(const char *text, int32_t x, int32_t y, uint8_t font);
+  int16_t drawString(const String &text, int32_t x, int32_t y) {
+    return drawString(text.c_str(), x, y, _font);
+  }
+  int16_t drawString(const String &text, int32_t x, int32_t y,
+                     uint8_t font) {
+    return drawString(text.c_str(), x, y, font);
+  }
+  int16_t drawCentreString(const char *text, int32_t x, int32_t y,
+                           uint8_t font);
+  int16_t textWidth(const char *text) { return textWidth(text, _font); }
+  int16_t textWidth(const char *text, uint8_t font);
+  int16_t fontHeight() { return fontHeight(_font); }
+  int16_t fontHeight(uint8_t font);
+
+  // Host only: copies a block of panel-order pixels onto this buffer at
+  // (x, y), clipped, as a blocking push
+  void pushBlock(int32_t x, int32_t y, int32_t w, int32_t h,
+                 const uint16_t *src, int32_t stride);
+
+  // Host only: what reached the panel
+  uint16_t panelPixel(int x, int y) const { return _buf[y * _w + x]; }
+  const uint16_t *panel() const { return _buf; }
+  uint32_t pushedPixels; // Pixels sent to the panel since the last reset
+  uint32_t pushes;       // Transfers (pushes, windows, DMA) since then
+  uint32_t dmaOverwrites; // DMA buffers changed while still in flight
+  uint32_t spiNsPerPixel; // Simulated transfer time, 0: instant
+  void resetCounters() { pushedPixels = pushes = dmaOverwrites = 0; }
+
+protected:
+  struct Sprite {}; // Tag for TFT_eSprite's constructor
+  explicit TFT_eSPI(Sprite);
+
+  uint16_t *_buf;
+  int _w, _h;
+  int _vpX, _vpY, _vpW, _vpH;
+  bool _swap;
+  uint8_t _font, _textSize, _datum;
+  uint16_t _fg, _bg;
+
+  bool _isSprite;
+  void put(int32_t x, int32_t y, uint32_t color); // Viewport coordinates
+  void transfer(uint32_t pixels); // Blocking push of that many pixels
+  void copyIn(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *src,
+              int32_t stride);
+
+private:
+  // DMA in flight
+  const uint16_t *_dmaData;
+  int _dmaX, _dmaY, _dmaW, _dmaH;
+  uint32_t _dmaSum;
+  uint64_t _dmaDone;
+
+  // Address window of pushPixels
+  int _winX, _winY, _winW, _winH, _winPos;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI *tft);
+  ~TFT_eSprite();
+
+  void *setColorDepth(int8_t depth) { return _buf; }
+  void setAttribute(uint8_t attr, uint8_t value) {}
+  void *createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() const { return _buf != nullptr; }
+  void *getPointer() { return _buf; }
+  void fillSprite(uint32_t color);
+
+  // Blocking pushes to the parent TFT
+  void pushSprite(int32_t x, int32_t y);
+  bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw,
+                  int32_t sh);
+
+private:
+  TFT_eSPI *_tft;
+};
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef WIRE_H
+#define WIRE_H
+
+#include <Arduino.h>
+
+// I2C bus with the one register-file device of host::board().i2c: a write
+// sets the register pointer, reads continue from it
+class TwoWire {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) {
+    return true;
+  }
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t address);
+  size_t write(uint8_t data);
+  uint8_t endTransmission(bool sendStop = true);
+  uint8_t requestFrom(uint8_t address, uint8_t quantity);
+  uint8_t requestFrom(int address, int quantity) {
+    return requestFrom((uint8_t)address, (uint8_t)quantity);
+  }
+  int available() { return _left; }
+  int read();
+
+private:
+  uint8_t _address;
+  bool _pointerSet;
+  int _left;
+};
+
+extern TwoWire Wire;
+
+#endif
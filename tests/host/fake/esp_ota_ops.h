@@ -0,0 +1,13 @@
+#ifndef ESP_OTA_OPS_H
+#define ESP_OTA_OPS_H
+
+#include "esp_partition.h"
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t *partition);
+void esp_restart();
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef ESP_PARTITION_H
+#define ESP_PARTITION_H
+
+#include <stdint.h>
+
+typedef enum { ESP_PARTITION_TYPE_APP = 0x00 } esp_partition_type_t;
+typedef enum { ESP_PARTITION_SUBTYPE_APP_OTA_0 = 0x10 } esp_partition_subtype_t;
+
+typedef struct {
+  uint32_t address;
+  uint32_t size;
+} esp_partition_t;
+
+// No partition table on the host: always NULL
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t sub,
+                                                const char *label);
+
+#endif
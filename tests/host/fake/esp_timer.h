@@ -0,0 +1,9 @@
+#ifndef ESP_TIMER_H
+#define ESP_TIMER_H
+
+#include <stdint.h>
+
+// Simulated clock, in microseconds since boot
+int64_t esp_timer_get_time();
+
+#endif
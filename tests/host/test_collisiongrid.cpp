@@ -0,0 +1,135 @@
+// CollisionGrid as SpaceShooter's checkCollisions() uses it, against testing
+// every bullet with every enemy: the same hits in the same order, and what
+// each costs with 200 bullets and 50 enemies
+
+#include "CollisionGrid.h"
+#include "HostTest.h"
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+using std::max;
+using std::min;
+
+static const float DT = 1.0f / 120;
+
+struct Body {
+  float x, y, vx, vy;
+  int width, height;
+  bool active;
+  int health;
+};
+
+typedef std::vector<std::pair<int, int>> Hits; // (bullet, enemy)
+
+// Swept bullet vs box, as in GameEngine.cpp
+static bool sweepAxis(float p, float d, float h, float &t0, float &t1) {
+  if (d == 0)
+    return p > -h && p < h;
+  float a = (-h - p) / d;
+  float b = (h - p) / d;
+  if (a > b)
+    std::swap(a, b);
+  t0 = max(t0, a);
+  t1 = min(t1, b);
+  return t0 < t1;
+}
+
+static bool bulletHits(const Body &b, const Body &e) {
+  float t0 = 0, t1 = 1;
+  float dx = b.vx * DT;
+  float dy = b.vy * DT;
+  return sweepAxis(b.x - dx - e.x, dx, e.width / 2 + b.width / 2, t0, t1) &&
+         sweepAxis(b.y - dy - e.y, dy, e.height / 2 + b.height / 2, t0, t1);
+}
+
+static void hit(Body &b, Body &e, int bi, int ei, Hits &hits) {
+  b.active = false;
+  if (--e.health <= 0)
+    e.active = false;
+  hits.push_back({bi, ei});
+}
+
+static void bruteForce(std::vector<Body> bullets, std::vector<Body> enemies,
+                       Hits &hits) {
+  for (int bi = 0; bi < (int)bullets.size(); bi++) {
+    Body &b = bullets[bi];
+    if (!b.active)
+      continue;
+    for (int ei = 0; ei < (int)enemies.size(); ei++) {
+      Body &e = enemies[ei];
+      if (e.active && bulletHits(b, e))
+        hit(b, e, bi, ei, hits);
+    }
+  }
+}
+
+static CollisionGrid<480, 320, 32> g_grid;
+
+static void gridded(std::vector<Body> bullets, std::vector<Body> enemies,
+                    Hits &hits) {
+  g_grid.clear();
+  for (int i = 0; i < (int)enemies.size(); i++) {
+    const Body &e = enemies[i];
+    if (e.active)
+      g_grid.add(i, e.x - e.width / 2, e.y - e.height / 2, e.x + e.width / 2,
+                 e.y + e.height / 2);
+  }
+  for (int bi = 0; bi < (int)bullets.size(); bi++) {
+    Body &b = bullets[bi];
+    if (!b.active)
+      continue;
+    float prevX = b.x - b.vx * DT;
+    float prevY = b.y - b.vy * DT;
+    uint64_t candidates = g_grid.query(
+        min(b.x, prevX) - b.width / 2, min(b.y, prevY) - b.height / 2,
+        max(b.x, prevX) + b.width / 2, max(b.y, prevY) + b.height / 2);
+    while (candidates) {
+      int ei = __builtin_ctzll(candidates);
+      candidates &= candidates - 1;
+      Body &e = enemies[ei];
+      if (e.active && bulletHits(b, e))
+        hit(b, e, bi, ei, hits);
+    }
+  }
+}
+
+int main() {
+  srand(1);
+  const int rounds = 2000;
+  int mismatches = 0;
+  long hits = 0;
+  double bruteUs = 0, gridUs = 0;
+  for (int round = 0; round < rounds; round++) {
+    // Bullets fly up at 1800-2500 px/s, so they cross an enemy in a tick
+    std::vector<Body> bullets(200), enemies(50);
+    for (Body &b : bullets)
+      b = {(float)(rand() % 480), (float)(rand() % 340 - 10),
+           (float)(rand() % 3 - 1) * 120, -(float)(1800 + rand() % 700), 4, 8,
+           true, 1};
+    for (Body &e : enemies)
+      e = {(float)(rand() % 480), (float)(rand() % 340 - 10), 0, 0, 24, 24,
+           true, 1 + rand() % 3};
+
+    Hits expected, got;
+    bruteUs += benchmarkUs(1, [&] { bruteForce(bullets, enemies, expected); });
+    gridUs += benchmarkUs(1, [&] { gridded(bullets, enemies, got); });
+    mismatches += expected != got;
+    hits += expected.size();
+  }
+  printf("%d ticks, %ld hits: %.1f us per tick testing every pair, %.1f us "
+         "with the grid\n",
+         rounds, hits, bruteUs / rounds, gridUs / rounds);
+  CHECK(hits > 0);
+  CHECK_EQ(mismatches, 0);
+
+  // Boxes off the field land in the border cells
+  g_grid.clear();
+  g_grid.add(3, -40, -40, -20, -20);
+  g_grid.add(5, 470, 310, 520, 360);
+  CHECK_EQ(g_grid.query(0, 0, 1, 1), 1 << 3);
+  CHECK_EQ(g_grid.query(479, 319, 479, 319), 1 << 5);
+  CHECK_EQ(g_grid.query(200, 100, 210, 110), 0);
+  return hostTestResult();
+}
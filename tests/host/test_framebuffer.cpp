@@ -0,0 +1,114 @@
+// RenderPipeline's framebuffer mode against the fake panel: after every
+// frame the panel holds what a full push would have left there, and only
+// the changed spans were sent (SPAN_MERGE_GAP, MAX_ROW_SPANS, rows sharing
+// one window)
+
+#include "HostBoard.h"
+#include "HostTest.h"
+#include "RenderPipeline.h"
+
+static const int WIDTH = 480;
+static const int HEIGHT = 320;
+static const int BAND = 32;
+static const int GAP = RenderPipeline::SPAN_MERGE_GAP;
+
+static int wrongPixels(const TFT_eSPI &tft, const uint16_t *frame) {
+  int wrong = 0;
+  for (int i = 0; i < WIDTH * HEIGHT; i++)
+    wrong += tft.panel()[i] != frame[i];
+  return wrong;
+}
+
+struct Fixture {
+  TFT_eSPI tft;
+  RenderPipeline pipeline;
+  TFT_eSprite *frame;
+
+  Fixture() : pipeline(&tft), frame(nullptr) {}
+
+  // Presents whatever draw() leaves in the framebuffer. Returns the pixels
+  // sent; the panel must then match the frame, as after a full push.
+  template <typename Draw> uint32_t present(Draw draw) {
+    tft.resetCounters();
+    pipeline.beginFrame();
+    frame = pipeline.beginStrip();
+    draw(*frame);
+    pipeline.pushStrip(0);
+    pipeline.endFrame();
+    CHECK_EQ(wrongPixels(tft, (const uint16_t *)frame->getPointer()), 0);
+    CHECK_EQ(pipeline.stats().bytes, tft.pushedPixels * 2);
+    CHECK_EQ(pipeline.stats().strips, tft.pushes);
+    CHECK(tft.getSwapBytes()); // Restored after the push
+    return tft.pushedPixels;
+  }
+};
+
+int main() {
+  host::reset();
+  host::board().psram = true;
+  Fixture f;
+  f.tft.setSwapBytes(true); // As the games leave it for pushImage()
+  CHECK(f.pipeline.begin(WIDTH, BAND, HEIGHT, RENDER_FRAMEBUFFER));
+  CHECK(f.pipeline.framebuffer());
+
+  // What is on the panel is unknown at first: one window, all of it
+  CHECK_EQ(f.present([](TFT_eSprite &s) { s.fillSprite(TFT_NAVY); }),
+           WIDTH * HEIGHT);
+  CHECK_EQ(f.pipeline.stats().strips, 1);
+
+  // Nothing changed, nothing sent
+  CHECK_EQ(f.present([](TFT_eSprite &) {}), 0);
+  CHECK_EQ(f.pipeline.stats().strips, 0);
+
+  // A 20 x 40 block: every row changes over the same span, one window
+  CHECK_EQ(f.present([](TFT_eSprite &s) {
+    s.fillRect(100, 50, 20, 40, TFT_RED);
+  }), 20 * 40);
+  CHECK_EQ(f.pipeline.stats().strips, 1);
+
+  // Moved 4 px right: per row the uncovered and the newly covered 4 px,
+  // 12 px apart, too far to merge. Two spans a row, none growing down
+  // since only single-span rows share a window.
+  CHECK_EQ(f.present([](TFT_eSprite &s) {
+    s.fillRect(100, 50, 4, 40, TFT_NAVY);
+    s.fillRect(120, 50, 4, 40, TFT_RED);
+  }), 2 * 4 * 40);
+  CHECK_EQ(f.pipeline.stats().strips, 2 * 40);
+
+  // Two changes GAP px apart merge into one span, the unchanged pixels
+  // between them sent along; one more apart they stay two spans
+  CHECK_EQ(f.present([](TFT_eSprite &s) {
+    s.drawPixel(10, 200, TFT_WHITE);
+    s.drawPixel(10 + GAP, 200, TFT_WHITE);
+    s.drawPixel(10, 201, TFT_WHITE);
+    s.drawPixel(10 + GAP + 1, 201, TFT_WHITE);
+  }), (GAP + 1) + 2);
+  CHECK_EQ(f.pipeline.stats().strips, 1 + 2);
+
+  // A row with more changes than MAX_ROW_SPANS: the extra ones are folded
+  // into the last span, which runs to the last change
+  const int dots = RenderPipeline::MAX_ROW_SPANS + 4;
+  const int step = GAP + 2;
+  CHECK_EQ(f.present([&](TFT_eSprite &s) {
+    for (int i = 0; i < dots; i++)
+      s.drawPixel(i * step, 300, TFT_YELLOW);
+  }), (RenderPipeline::MAX_ROW_SPANS - 1) +
+          ((dots - 1) * step + 1 - (RenderPipeline::MAX_ROW_SPANS - 1) * step));
+  CHECK_EQ(f.pipeline.stats().strips, RenderPipeline::MAX_ROW_SPANS);
+
+  // Random scenes, every one checked against the full push; the diff never
+  // sends more than a full frame and only as many windows as rows allow
+  randomSeed(8);
+  for (int i = 0; i < 200; i++) {
+    uint32_t sent = f.present([](TFT_eSprite &s) {
+      int n = random(0, 6);
+      for (int k = 0; k < n; k++)
+        s.fillRect(random(-20, WIDTH), random(-20, HEIGHT), random(1, 60),
+                   random(1, 60), random(0, 0x10000));
+    });
+    CHECK(sent <= WIDTH * HEIGHT);
+    CHECK(f.pipeline.stats().strips <=
+          HEIGHT * RenderPipeline::MAX_ROW_SPANS);
+  }
+  return hostTestResult();
+}
@@ -0,0 +1,192 @@
+// Input on the host: InputSampler's debounce, event times and ring as the
+// 1 kHz sampler drives it from the board pins, and the buttons through
+// Input::poll() as the games see them
+
+#include "HostBoard.h"
+#include "HostTest.h"
+#include "Input.h"
+
+// The sampler task's loop: one sample of the pins every millisecond
+static void sample(InputSampler &s, int ms,
+                   InputDirection dir = INPUT_DIR_NONE) {
+  for (int i = 0; i < ms; i++) {
+    host::advance(1000);
+    s.sample(!digitalRead(BUTTON_A_PIN), !digitalRead(BUTTON_B_PIN), dir,
+             micros());
+  }
+}
+
+static void setA(bool pressed) {
+  host::board().pin[BUTTON_A_PIN] = pressed ? LOW : HIGH;
+}
+
+// Contact bounce and short glitches are filtered; events carry the time
+// the level last changed, not the time the debounce let it through
+static void testDebounce() {
+  host::reset();
+  InputSampler s;
+  InputEvent e;
+  sample(s, 10);
+
+  setA(true); // 3 ms glitch
+  sample(s, 3);
+  setA(false);
+  sample(s, 20);
+  CHECK(!s.pop(e));
+
+  for (int i = 0; i < 4; i++) { // Bouncing, then held
+    setA(i % 2 == 0);
+    sample(s, 1);
+  }
+  setA(true);
+  uint32_t edge = micros() + 1000; // First sample seeing it settled
+  sample(s, InputSampler::DEBOUNCE_US / 1000);
+  CHECK(!s.pop(e)); // Not yet held DEBOUNCE_US
+  sample(s, 1);
+  CHECK(s.pop(e));
+  CHECK_EQ(e.type, INPUT_PRESS);
+  CHECK_EQ(e.source, INPUT_BUTTON_A);
+  CHECK_EQ(e.time, edge);
+  CHECK(!s.pop(e));
+
+  setA(false);
+  edge = micros() + 1000;
+  sample(s, 20);
+  CHECK(s.pop(e));
+  CHECK_EQ(e.type, INPUT_RELEASE);
+  CHECK_EQ(e.time, edge);
+  CHECK(!s.pop(e));
+  CHECK_EQ(s.dropped(), 0);
+}
+
+// A held direction: NAV once settled, dated when it started, then REPEAT
+// after REPEAT_DELAY_US and every REPEAT_PERIOD_US
+static void testJoystickRepeat() {
+  host::reset();
+  InputSampler s;
+  InputEvent e;
+  sample(s, 10);
+  uint32_t start = micros() + 1000;
+  sample(s, 1000, INPUT_DIR_LEFT);
+  CHECK(s.pop(e));
+  CHECK_EQ(e.type, INPUT_NAV);
+  CHECK_EQ(e.dir, INPUT_DIR_LEFT);
+  CHECK_EQ(e.time, start);
+  uint32_t due = start + InputSampler::REPEAT_DELAY_US;
+  int repeats = 0;
+  while (s.pop(e)) {
+    CHECK_EQ(e.type, INPUT_REPEAT);
+    CHECK_EQ(e.time, due);
+    due += InputSampler::REPEAT_PERIOD_US;
+    repeats++;
+  }
+  CHECK_EQ(repeats, 4); // At 300, 500, 700 and 900 ms
+}
+
+// Nobody draining: the ring keeps the oldest RING_SIZE events in order
+// and counts the rest as dropped, then takes new ones once drained
+static void testRingOverflow() {
+  host::reset();
+  InputSampler s;
+  InputEvent e;
+  const int presses = InputSampler::RING_SIZE; // Two events each
+  for (int i = 0; i < presses; i++) {
+    setA(true);
+    sample(s, 10);
+    setA(false);
+    sample(s, 10);
+  }
+  CHECK_EQ(s.dropped(), presses);
+  uint32_t last = 0;
+  for (int i = 0; i < InputSampler::RING_SIZE; i++) {
+    CHECK(s.pop(e));
+    CHECK_EQ(e.type, i % 2 ? INPUT_RELEASE : INPUT_PRESS);
+    CHECK(e.time > last);
+    last = e.time;
+  }
+  CHECK(!s.pop(e));
+
+  setA(true);
+  sample(s, 10);
+  CHECK(s.pop(e));
+  CHECK_EQ(e.type, INPUT_PRESS);
+}
+
+// micros() wraps every 71 minutes; debounce and times run across it
+static void testMicrosWrap() {
+  host::reset();
+  host::advance(0xFFFFFFFFull - 2500);
+  InputSampler s;
+  InputEvent e;
+  sample(s, 1);
+  setA(true);
+  uint32_t edge = micros() + 1000;
+  sample(s, 10);
+  CHECK(s.pop(e));
+  CHECK_EQ(e.type, INPUT_PRESS);
+  CHECK_EQ(e.time, edge);
+  CHECK(micros() < edge); // Wrapped meanwhile
+}
+
+// One game tick of 1 ms; without tasks poll() samples the pins itself
+static ButtonInput tick(Input &input) {
+  host::advance(1000);
+  input.poll();
+  return input.getButtons();
+}
+
+// Buttons set for n ticks: what the game saw of them meanwhile
+struct Seen {
+  bool pressed; // A press (aJustPressed / bJustPressed)
+  bool held;    // aPressed / bPressed on the last tick
+};
+static Seen hold(Input &input, bool a, bool b, int n) {
+  host::board().pin[BUTTON_A_PIN] = a ? LOW : HIGH;
+  host::board().pin[BUTTON_B_PIN] = b ? LOW : HIGH;
+  Seen seen = {false, false};
+  for (int i = 0; i < n; i++) {
+    ButtonInput buttons = tick(input);
+    seen.pressed |= buttons.aJustPressed || buttons.bJustPressed;
+    seen.held = buttons.aPressed || buttons.bPressed;
+  }
+  return seen;
+}
+
+// A+B together toggles the overlay and never reaches the game, even while
+// one of them is let go first
+static void testProfilerChordIsSwallowed() {
+  host::reset();
+  Input input;
+  input.begin();
+  CHECK(!Profiler::overlayVisible());
+
+  Seen seen = hold(input, true, true, 20);
+  CHECK(!seen.pressed && !seen.held);
+  CHECK(Profiler::overlayVisible());
+  seen = hold(input, false, true, 20);
+  CHECK(!seen.pressed && !seen.held);
+  seen = hold(input, false, false, 20);
+  CHECK(!seen.pressed && !seen.held);
+  CHECK(Profiler::overlayVisible());
+
+  // Single buttons still work, and the chord again hides the overlay
+  seen = hold(input, true, false, 20);
+  CHECK(seen.pressed && seen.held);
+  hold(input, false, false, 20);
+  seen = hold(input, false, true, 20);
+  CHECK(seen.pressed && seen.held);
+  hold(input, false, false, 20);
+  seen = hold(input, true, true, 20);
+  CHECK(!seen.pressed && !seen.held);
+  hold(input, false, false, 20);
+  CHECK(!Profiler::overlayVisible());
+}
+
+int main() {
+  testDebounce();
+  testJoystickRepeat();
+  testRingOverflow();
+  testMicrosWrap();
+  testProfilerChordIsSwallowed();
+  return hostTestResult();
+}
@@ -0,0 +1,167 @@
+// Joystick on the host: the filter's step response, the calibrator's
+// center, range and deadzone, getJoystick() around the deadzone, and the
+// launcher's calibration screen run by a simulated user
+
+#include "../../JoystickSetup.h"
+#include "HostBoard.h"
+#include "HostTest.h"
+#include "Input.h"
+#include <freertos/task.h>
+
+// Spikes are dropped, a step is followed without overshoot and the
+// average settles on the input, not a count short of it
+static void testFilter() {
+  JoystickFilter f;
+  f.reset(2048);
+  CHECK_EQ(f.update(4095), 2048); // One sample spike
+  CHECK_EQ(f.update(2048), 2048);
+  CHECK_EQ(f.update(2048), 2048);
+
+  // The median holds a step back one sample, then each sample closes a
+  // quarter of the gap
+  CHECK_EQ(f.update(3000), 2048);
+  int last = 2048;
+  for (int i = 1; i <= 40; i++) {
+    int v = f.update(3000);
+    CHECK(v >= last && v <= 3000);
+    if (i == 3)
+      CHECK(v > 2048 + 952 / 2 && v < 2048 + 952 * 3 / 4);
+    last = v;
+  }
+  CHECK_EQ(last, 3000);
+}
+
+static void testCalibrator() {
+  // Rest around (2000, 2100), swept to (300..3900, 200..4000)
+  JoystickCalibrator c;
+  JoystickCalibration cal;
+  CHECK(!c.result(cal)); // Nothing seen
+  for (int i = 0; i < 100; i++)
+    c.sampleRest(2000 + (i % 3) - 1, 2100 + (i % 3) - 1);
+  c.sampleTravel(300, 2100);
+  c.sampleTravel(3900, 2100);
+  c.sampleTravel(2000, 200);
+  CHECK(!c.result(cal)); // Never pushed down
+  c.sampleTravel(2000, 4000);
+  CHECK(c.result(cal));
+  CHECK_EQ(cal.centerX, 2000);
+  CHECK_EQ(cal.centerY, 2100);
+  CHECK_EQ(cal.minX, 300);
+  CHECK_EQ(cal.maxX, 3900);
+  CHECK_EQ(cal.minY, 200);
+  CHECK_EQ(cal.maxY, 4000);
+  CHECK_EQ(cal.deadzone, JOYSTICK_MIN_DEADZONE); // Quiet stick
+
+  // A noisy one gets three times its noise: +-100 counts at rest is
+  // 100 * 2047 / 1900 up and 100 * 2047 / 1700 down on this range
+  JoystickCalibrator noisy;
+  noisy.sampleRest(1900, 2000);
+  noisy.sampleRest(2100, 2000);
+  noisy.sampleTravel(300, 300);
+  noisy.sampleTravel(3900, 3900);
+  CHECK(noisy.result(cal));
+  CHECK_EQ(cal.centerX, 2000);
+  CHECK_EQ(cal.deadzone, 3 * (107 + 120));
+}
+
+// Stick held at (x, y) long enough for the 1 kHz sampler to settle
+static JoystickInput stick(Input &input, int x, int y) {
+  host::board().adc[JOYSTICK_X_PIN] = x;
+  host::board().adc[JOYSTICK_Y_PIN] = y;
+  host::advance(50000);
+  input.poll();
+  return input.getJoystick();
+}
+
+static void testDeadzone() {
+  host::reset();
+  host::board().tasks = true;
+  Input input;
+  input.begin(); // Uncalibrated: center 2048, deadzone 800
+
+  JoystickInput joy = stick(input, 2048 + 700, 2048 - 500);
+  CHECK(!joy.active);
+  CHECK_EQ(joy.direction, INPUT_DIR_NONE);
+  CHECK_EQ(joy.x, 0);
+  CHECK_EQ(joy.y, 0);
+
+  joy = stick(input, 2048 + 1000, 2048 - 500);
+  CHECK(joy.active);
+  CHECK_EQ(joy.direction, INPUT_DIR_RIGHT);
+  CHECK(joy.x > 990 && joy.x < 1010);
+  CHECK(joy.y < -490 && joy.y > -510);
+
+  joy = stick(input, 0, 2048);
+  CHECK_EQ(joy.direction, INPUT_DIR_LEFT);
+  CHECK_EQ(joy.x, -JOYSTICK_SCALE);
+}
+
+// The user at the launcher's calibration screen: lets go of A+B, leaves
+// the stick alone (with some ADC noise), sweeps it to its stops, presses A
+static void setStick(int x, int y, int ms) {
+  host::board().adc[JOYSTICK_X_PIN] = x;
+  host::board().adc[JOYSTICK_Y_PIN] = y;
+  vTaskDelay(ms);
+}
+
+static void user(void *) {
+  vTaskDelay(100);
+  host::board().pin[BUTTON_A_PIN] = HIGH;
+  host::board().pin[BUTTON_B_PIN] = HIGH;
+  for (int i = 0; i < 1600; i++)
+    setStick(2000 + (i % 2 ? 6 : -6), 2100 + (i % 2 ? -6 : 6), 1);
+  setStick(300, 2100, 100);
+  setStick(3900, 2100, 100);
+  setStick(2000, 200, 100);
+  setStick(2000, 4000, 100);
+  setStick(2000, 2100, 100);
+  host::board().pin[BUTTON_A_PIN] = LOW;
+  vTaskDelay(50);
+  host::board().pin[BUTTON_A_PIN] = HIGH;
+}
+
+static void testCalibrationScreen() {
+  host::reset();
+  host::board().tasks = true;
+  host::board().pin[BUTTON_A_PIN] = LOW; // Held at power-on
+  host::board().pin[BUTTON_B_PIN] = LOW;
+  TFT_eSPI tft;
+  Input input;
+  input.begin();
+  xTaskCreate(user, "user", 2048, nullptr, 1, nullptr);
+
+  calibrateJoystick(tft, input);
+  const JoystickCalibration &cal = input.getCalibration();
+  CHECK(abs(cal.centerX - 2000) <= 2);
+  CHECK(abs(cal.centerY - 2100) <= 2);
+  CHECK_EQ(cal.minX, 300);
+  CHECK_EQ(cal.maxX, 3900);
+  CHECK_EQ(cal.minY, 200);
+  CHECK_EQ(cal.maxY, 4000);
+  CHECK_EQ(cal.deadzone, JOYSTICK_MIN_DEADZONE);
+
+  // Saved for the games: another Input loads it
+  Input game;
+  game.begin();
+  const JoystickCalibration &loaded = game.getCalibration();
+  CHECK_EQ(loaded.centerX, cal.centerX);
+  CHECK_EQ(loaded.minY, cal.minY);
+  CHECK_EQ(loaded.deadzone, cal.deadzone);
+
+  // Read through it: 200 counts off center is now inside the deadzone,
+  // the stop is full scale
+  JoystickInput joy = stick(game, cal.centerX + 200, cal.centerY);
+  CHECK(!joy.active);
+  CHECK_EQ(joy.x, 0);
+  joy = stick(game, 3900, cal.centerY);
+  CHECK_EQ(joy.direction, INPUT_DIR_RIGHT);
+  CHECK_EQ(joy.x, JOYSTICK_SCALE);
+}
+
+int main() {
+  testFilter();
+  testCalibrator();
+  testDeadzone();
+  testCalibrationScreen();
+  return hostTestResult();
+}
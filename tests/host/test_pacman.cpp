@@ -0,0 +1,398 @@
+// PacMan on the host: what a gameplay frame costs on the panel, that the
+// damaged-tile frames still show the same picture as a full redraw, that
+// ghosts find their way with the distance tables, that the tile bytes,
+// their exits and the dot counter agree with the maze, and that skins and
+// maze themes draw from their palette tables
+
+#include "GameEngine.h"
+#include "HostBoard.h"
+#include "HostTest.h"
+#include <cstdlib>
+#include <queue>
+
+static const int PANEL_PIXELS = TFT_PANEL_W * TFT_PANEL_H;
+static const int TICKS_PER_FRAME = GameEngine::TICK_HZ / GameEngine::RENDER_HZ;
+
+// Maze placement, as in GameEngine.cpp
+static const int TILE = 24;
+static const int MAZE_X = 10;
+static const int MAZE_Y = 4;
+
+static uint16_t panelOrder(uint16_t c) { return (uint16_t)(c << 8 | c >> 8); }
+
+struct Console {
+  TFT_eSPI tft;
+  Input input;
+  GameEngine engine{&tft, &input};
+
+  Console() {
+    input.begin();
+    engine.init();
+  }
+
+  void tick() {
+    host::advance(1000000 / GameEngine::TICK_HZ);
+    engine.update(1.0f / GameEngine::TICK_HZ);
+  }
+
+  // One LoopDriver frame: the ticks due, then a draw. Pixels pushed by it.
+  uint32_t frame() {
+    for (int i = 0; i < TICKS_PER_FRAME; i++)
+      tick();
+    tft.resetCounters();
+    engine.draw(0.5f);
+    return tft.pushedPixels;
+  }
+
+  // Menu item 0 with button A
+  void startGame() {
+    host::board().pin[BUTTON_A_PIN] = LOW;
+    for (int i = 0; i < 10; i++)
+      frame();
+    host::board().pin[BUTTON_A_PIN] = HIGH;
+    for (int i = 0; i < 10; i++)
+      frame();
+  }
+};
+
+// Stick held in one of four directions, changing every second
+static void steer(int frame) {
+  static const uint16_t x[4] = {2048, 4095, 2048, 0};
+  static const uint16_t y[4] = {0, 2048, 4095, 2048};
+  int d = (frame / GameEngine::RENDER_HZ) % 4;
+  host::board().adc[JOYSTICK_X_PIN] = x[d];
+  host::board().adc[JOYSTICK_Y_PIN] = y[d];
+}
+
+// Pixels that differ between the panel and what a fresh render-only engine
+// draws from the same state in one full frame
+static int diffFromFullRedraw(Console &console) {
+  RenderState state;
+  console.engine.snapshot(state);
+  TFT_eSPI tft;
+  Input input;
+  GameEngine view(&tft, &input);
+  view.initRender();
+  view.applySnapshot(state);
+  view.draw(0.5f);
+  int diff = 0;
+  for (int i = 0; i < PANEL_PIXELS; i++)
+    diff += console.tft.panel()[i] != tft.panel()[i];
+  return diff;
+}
+
+static void testGameplayPushesOnlyDamage() {
+  host::reset();
+  Console console;
+  console.startGame();
+  RenderState state;
+  console.engine.snapshot(state);
+  CHECK_EQ(state._state, STATE_PLAYING);
+
+  const int frames = 10 * GameEngine::RENDER_HZ;
+  uint64_t total = 0;
+  uint32_t worst = 0;
+  for (int i = 0; i < frames; i++) {
+    steer(i);
+    uint32_t pixels = console.frame();
+    total += pixels;
+    worst = max(worst, pixels);
+    if (i % 30 == 29)
+      CHECK_EQ(diffFromFullRedraw(console), 0);
+  }
+  double average = (double)total / frames;
+  printf("gameplay: %.0f px/frame on average (%.1f%% of the panel), "
+         "worst %u\n",
+         average, 100.0 * average / PANEL_PIXELS, worst);
+  CHECK(average < PANEL_PIXELS / 10);
+  console.engine.snapshot(state);
+  CHECK(state._dotsEaten > 0); // Pac-Man did get around
+}
+
+// Pac-Man caught by a ghost: the next frame draws it at the spawn point,
+// not sliding over from where it died
+static void testRespawnDoesNotInterpolate() {
+  host::reset();
+  Console console;
+  console.startGame();
+  console.frame();
+
+  RenderState state;
+  console.engine.snapshot(state);
+  int before = state._lives;
+  for (auto &ghost : state._ghosts) {
+    ghost.frightened = false;
+    ghost.eaten = false;
+  }
+  state._frightenedMode = false;
+  state._ghosts[0].pos = state._ghosts[0].prevPos = state._pacman;
+  console.engine.applySnapshot(state);
+  console.frame();
+
+  console.engine.snapshot(state);
+  CHECK_EQ(state._lives, before - 1);
+  CHECK_EQ(state._prevPacman.x, state._pacman.x);
+  CHECK_EQ(state._prevPacman.y, state._pacman.y);
+  CHECK_EQ(diffFromFullRedraw(console), 0);
+}
+
+// Walking distances from (x0, y0) to every tile along the exits, one BFS
+// over the grid: what DistanceField must agree with
+typedef int Distances[13][17];
+static void referenceBfs(const uint8_t tiles[13][17], int x0, int y0,
+                         Distances dist) {
+  static const int dx[4] = {0, 0, -1, 1};
+  static const int dy[4] = {-1, 1, 0, 0};
+  for (int y = 0; y < 13; y++)
+    for (int x = 0; x < 17; x++)
+      dist[y][x] = DistanceField<17, 13, 128>::FAR;
+  std::queue<Position> queue;
+  dist[y0][x0] = 0;
+  queue.push({x0, y0});
+  while (!queue.empty()) {
+    Position p = queue.front();
+    queue.pop();
+    for (int dir = 0; dir < 4; dir++) {
+      int x = p.x + dx[dir], y = p.y + dy[dir];
+      if ((tiles[p.y][p.x] & (1 << dir)) &&
+          !(tiles[y][x] & (TILE_WALL | TILE_CAGE)) &&
+          dist[y][x] == DistanceField<17, 13, 128>::FAR) {
+        dist[y][x] = dist[p.y][p.x] + 1;
+        queue.push({x, y});
+      }
+    }
+  }
+}
+
+static bool closed(const uint8_t tiles[13][17], int x, int y) {
+  return tiles[y][x] & (TILE_WALL | TILE_CAGE);
+}
+
+// The tables built from the maze loadMaze() leaves, against a BFS from
+// every open tile; closed targets stand for the nearest open tile
+static void testDistanceFieldMatchesBfs() {
+  host::reset();
+  Console console;
+  console.startGame();
+  RenderState state;
+  console.engine.snapshot(state);
+  static DistanceField<17, 13, 128> paths;
+  CHECK(paths.build(state._tiles, TILE_WALL | TILE_CAGE));
+
+  int pairs = 0, mismatches = 0;
+  for (int y0 = 0; y0 < 13; y0++) {
+    for (int x0 = 0; x0 < 17; x0++) {
+      if (closed(state._tiles, x0, y0))
+        continue;
+      Distances dist;
+      referenceBfs(state._tiles, x0, y0, dist);
+      for (int y1 = 0; y1 < 13; y1++) {
+        for (int x1 = 0; x1 < 17; x1++) {
+          // Nearest open tile, first in row order on ties
+          int nx = x1, ny = y1, best = 17 + 13;
+          for (int y = 0; y < 13 && closed(state._tiles, x1, y1); y++)
+            for (int x = 0; x < 17; x++)
+              if (!closed(state._tiles, x, y) &&
+                  abs(x - x1) + abs(y - y1) < best) {
+                best = abs(x - x1) + abs(y - y1);
+                nx = x;
+                ny = y;
+              }
+          mismatches += paths.distance(x0, y0, x1, y1) != dist[ny][nx];
+          pairs++;
+        }
+      }
+    }
+  }
+  printf("%d open tiles, %d distances compared\n", paths.nodes(), pairs);
+  CHECK_EQ(mismatches, 0);
+  // Targets off the maze are clamped into it
+  CHECK_EQ(paths.distance(1, 1, -5, -5), paths.distance(1, 1, 0, 0));
+}
+
+// An eaten ghost goes back to the cage door as eyes, a step per ghost move
+// along a shortest path, and only then comes back to life in the box
+static void testEatenGhostWalksHome() {
+  host::reset();
+  Console console;
+  console.startGame();
+  RenderState state;
+  console.engine.snapshot(state);
+  // Everyone else frightened, so Pac-Man is not caught meanwhile
+  state._frightenedMode = true;
+  state._frightenedStart = millis();
+  state._frightenedTime = 8000;
+  for (auto &ghost : state._ghosts)
+    ghost.frightened = true;
+  Ghost &eyes = state._ghosts[0];
+  eyes.frightened = false;
+  eyes.eaten = true;
+  eyes.pos = eyes.prevPos = {1, 11}; // Bottom left corner
+  eyes.dir = DIR_LEFT;
+  console.engine.applySnapshot(state);
+
+  Distances dist;
+  referenceBfs(state._tiles, 8, 5, dist);
+  int expected = dist[11][1];
+  int moves = 0, lives = state._lives;
+  Position at = {1, 11};
+  for (int i = 0; i < 20 * GameEngine::TICK_HZ; i++) {
+    console.tick();
+    console.engine.snapshot(state);
+    const Ghost &ghost = state._ghosts[0];
+    if (!ghost.eaten)
+      break;
+    if (ghost.pos.x != at.x || ghost.pos.y != at.y) {
+      CHECK_EQ(abs(ghost.pos.x - at.x) + abs(ghost.pos.y - at.y), 1);
+      at = ghost.pos;
+      moves++;
+    }
+    if (moves == expected / 2 && i % TICKS_PER_FRAME == 0) {
+      console.tft.resetCounters();
+      console.engine.draw(0.5f);
+      CHECK_EQ(diffFromFullRedraw(console), 0); // Eyes drawn either way
+    }
+  }
+  printf("eyes home in %d moves, %d on the shortest path\n", moves,
+         expected);
+  CHECK_EQ(state._lives, lives);
+  CHECK_EQ(moves, expected);
+  CHECK(!state._ghosts[0].eaten);
+  CHECK_EQ(state._ghosts[0].pos.x, 8);
+  CHECK_EQ(state._ghosts[0].pos.y, 6);
+}
+
+static int dotTiles(const RenderState &state) {
+  int dots = 0;
+  for (int y = 0; y < 13; y++)
+    for (int x = 0; x < 17; x++)
+      dots += (state._tiles[y][x] & (TILE_DOT | TILE_PELLET)) != 0;
+  return dots;
+}
+
+// The tile bytes loadMaze() builds: a closed border, the cage, exit bits
+// towards every open neighbour, and _dotsLeft counting the dots and
+// pellets on the maze through play and into the next level
+static void testMazeTiles() {
+  host::reset();
+  Console console;
+  console.startGame();
+  RenderState state;
+  console.engine.snapshot(state);
+  const int dots = dotTiles(state);
+  CHECK_EQ(state._dotsLeft, dots);
+  CHECK(dots > 100);
+
+  int walls = 0;
+  for (int y = 0; y < 13; y++) {
+    for (int x = 0; x < 17; x++) {
+      uint8_t tile = state._tiles[y][x];
+      if (x == 0 || y == 0 || x == 16 || y == 12)
+        CHECK(tile & TILE_WALL);
+      walls += (tile & TILE_WALL) != 0;
+      CHECK(!(tile & TILE_WALL) || !(tile & (TILE_DOT | TILE_PELLET)));
+      int exits = 0;
+      for (int dir = 0; dir < 4; dir++) {
+        int nx = x + DIR_DX[dir], ny = y + DIR_DY[dir];
+        if (nx >= 0 && nx < 17 && ny >= 0 && ny < 13 &&
+            !(state._tiles[ny][nx] & (TILE_WALL | TILE_CAGE)))
+          exits |= 1 << dir;
+      }
+      CHECK_EQ(tile & TILE_EXITS, exits);
+    }
+  }
+  CHECK(walls > 0 && walls + dots < 13 * 17);
+  for (int x = 6; x <= 8; x++) // Cage
+    CHECK_EQ(state._tiles[6][x] & ~TILE_EXITS, TILE_CAGE);
+  CHECK_EQ(state._tiles[1][1], TILE_DOT | 1 << DIR_DOWN | 1 << DIR_RIGHT);
+  CHECK(state._tiles[2][1] & TILE_PELLET);
+
+  // Eating keeps the counter on the dots left on the maze
+  for (int i = 0; i < 5 * GameEngine::RENDER_HZ; i++) {
+    steer(i);
+    console.frame();
+    console.engine.snapshot(state);
+    if (state._state != STATE_PLAYING)
+      break;
+    CHECK_EQ(state._dotsLeft, dotTiles(state));
+  }
+  CHECK(state._dotsLeft < dots);
+
+  // The last dot ends the level: the maze is laid out again
+  console.engine.snapshot(state);
+  for (auto &row : state._tiles)
+    for (uint8_t &tile : row)
+      tile &= ~(TILE_DOT | TILE_PELLET);
+  state._pacman = state._prevPacman = {8, 9};
+  state._tiles[8][8] |= TILE_DOT;
+  state._dotsLeft = 1;
+  for (auto &ghost : state._ghosts) {
+    ghost.frightened = true; // Nobody catches Pac-Man meanwhile
+    ghost.eaten = false;
+  }
+  state._frightenedMode = true;
+  state._frightenedStart = millis();
+  state._frightenedTime = 8000;
+  int level = state._level;
+  console.engine.applySnapshot(state);
+  host::board().adc[JOYSTICK_X_PIN] = 2048;
+  host::board().adc[JOYSTICK_Y_PIN] = 0; // Up, onto the dot
+  for (int i = 0; i < GameEngine::RENDER_HZ; i++) {
+    console.frame();
+    console.engine.snapshot(state);
+    if (state._level != level)
+      break;
+  }
+  CHECK_EQ(state._level, level + 1);
+  CHECK_EQ(state._dotsLeft, dots);
+  CHECK_EQ(dotTiles(state), dots);
+}
+
+// The saved skin and theme are loaded, and each one draws Pac-Man and the
+// walls in its entry of pacman_skin_colors / maze_themes
+static void testSkinAndThemePalettes() {
+  host::reset();
+  SaveStore<PacManSave, 1> store;
+  store.begin("pacman");
+  store.set({0, 0, 0xFF, 0x0F, 5, 2});
+  store.flush();
+  Console console;
+  console.startGame();
+  RenderState state;
+  console.engine.snapshot(state);
+  CHECK_EQ(state._selectedSkin, 5);
+  CHECK_EQ(state._selectedTheme, 2);
+
+  for (int skin = 0; skin < 8; skin++) {
+    int theme = skin % 4;
+    state._selectedSkin = skin;
+    state._selectedTheme = theme;
+    state._mouthOpen = false; // Pac-Man's centre is then its colour
+    state._prevPacman = state._pacman;
+    TFT_eSPI tft;
+    Input input;
+    GameEngine view(&tft, &input);
+    view.initRender();
+    view.applySnapshot(state);
+    view.draw(0.5f);
+
+    int x = MAZE_X + state._pacman.x * TILE + TILE / 2;
+    int y = MAZE_Y + state._pacman.y * TILE + TILE / 2;
+    CHECK_EQ(tft.panelPixel(x, y), panelOrder(pacman_skin_colors[skin]));
+    // Top left wall tile: outline, then fill
+    CHECK_EQ(tft.panelPixel(MAZE_X, MAZE_Y),
+             panelOrder(maze_themes[theme].wall));
+    CHECK_EQ(tft.panelPixel(MAZE_X + TILE / 2, MAZE_Y + TILE / 2),
+             panelOrder(maze_themes[theme].wallInner));
+  }
+}
+
+int main() {
+  testGameplayPushesOnlyDamage();
+  testRespawnDoesNotInterpolate();
+  testDistanceFieldMatchesBfs();
+  testEatenGhostWalksHome();
+  testMazeTiles();
+  testSkinAndThemePalettes();
+  return hostTestResult();
+}
@@ -0,0 +1,104 @@
+// RenderPipeline against a panel whose SPI transfers take time: with two DMA
+// buffers a strip is drawn while the last one is still being sent, and no
+// buffer is drawn into while in flight
+
+#include "HostBoard.h"
+#include "HostTest.h"
+#include "RenderPipeline.h"
+
+static const int WIDTH = 480;
+static const int HEIGHT = 320;
+static const int BAND = 32;
+static const uint32_t SPI_NS_PER_PIXEL = 200; // 80 MHz, 16 bpp
+static const uint32_t RENDER_US = 2000;       // Drawing one strip
+
+static uint16_t stripColor(uint16_t frame, int y) {
+  return (uint16_t)(frame * 1000 + y);
+}
+
+// One frame: every strip filled with its own colour, drawing taking
+// RENDER_US of simulated time per strip. Returns the frame's duration.
+static uint64_t drawFrame(RenderPipeline &pipeline, uint16_t frame) {
+  uint64_t start = host::board().now;
+  pipeline.beginFrame();
+  for (int y = 0; y < HEIGHT; y += pipeline.stripHeight()) {
+    TFT_eSprite *strip = pipeline.beginStrip();
+    for (int row = 0; row < pipeline.stripHeight(); row += BAND) {
+      pipeline.selectBand(row);
+      strip->fillSprite(stripColor(frame, y + row));
+    }
+    host::advance(RENDER_US);
+    pipeline.pushStrip(y);
+  }
+  pipeline.endFrame();
+  return host::board().now - start;
+}
+
+static int wrongPixels(const TFT_eSPI &tft, uint16_t frame) {
+  int wrong = 0;
+  for (int y = 0; y < HEIGHT; y++) {
+    uint16_t c = stripColor(frame, y - y % BAND);
+    uint16_t panel = (uint16_t)(c << 8 | c >> 8);
+    for (int x = 0; x < WIDTH; x++)
+      wrong += tft.panelPixel(x, y) != panel;
+  }
+  return wrong;
+}
+
+struct Run {
+  uint64_t frameUs;
+  PipelineStats stats;
+};
+
+static Run run(bool dma) {
+  host::reset();
+  host::board().dma = dma;
+  TFT_eSPI tft;
+  tft.spiNsPerPixel = SPI_NS_PER_PIXEL;
+  tft.setSwapBytes(true); // As the games leave it for pushImage()
+  RenderPipeline pipeline(&tft);
+  CHECK(pipeline.begin(WIDTH, BAND, HEIGHT));
+  CHECK_EQ(pipeline.bufferCount(), 2);
+
+  Run r = {0, {}};
+  for (uint16_t frame = 1; frame <= 3; frame++) {
+    tft.resetCounters();
+    r.frameUs = drawFrame(pipeline, frame);
+    CHECK_EQ(wrongPixels(tft, frame), 0);
+    CHECK_EQ(tft.dmaOverwrites, 0);
+    CHECK_EQ(tft.pushedPixels, WIDTH * HEIGHT);
+    CHECK(tft.getSwapBytes()); // Restored after the pushes
+  }
+  r.stats = pipeline.stats();
+  return r;
+}
+
+int main() {
+  Run blocking = run(false);
+  Run overlapped = run(true);
+
+  uint64_t strips = HEIGHT / BAND;
+  uint64_t transferUs = (uint64_t)WIDTH * HEIGHT * SPI_NS_PER_PIXEL / 1000;
+  printf("blocking: %llu us/frame (render %lu, wait %lu)\n",
+         (unsigned long long)blocking.frameUs,
+         (unsigned long)blocking.stats.renderUs,
+         (unsigned long)blocking.stats.waitUs);
+  printf("DMA:      %llu us/frame (render %lu, wait %lu)\n",
+         (unsigned long long)overlapped.frameUs,
+         (unsigned long)overlapped.stats.renderUs,
+         (unsigned long)overlapped.stats.waitUs);
+
+  // Blocking pushes add up; with DMA only the first strip's drawing is not
+  // hidden behind a transfer
+  CHECK_EQ(blocking.frameUs, strips * RENDER_US + transferUs);
+  CHECK_EQ(overlapped.frameUs, RENDER_US + transferUs);
+
+  // The split covers the whole frame either way
+  CHECK_EQ(blocking.stats.renderUs, strips * RENDER_US);
+  CHECK_EQ(blocking.stats.waitUs, transferUs);
+  CHECK_EQ(overlapped.stats.renderUs, strips * RENDER_US);
+  CHECK_EQ(overlapped.stats.renderUs + overlapped.stats.waitUs,
+           overlapped.frameUs);
+  CHECK_EQ(overlapped.stats.bytes, WIDTH * HEIGHT * 2);
+  return hostTestResult();
+}
@@ -0,0 +1,92 @@
+// SpaceShooter's Pool: removal moves the last item into the hole, a full
+// pool refuses spawns and counts them, and the backwards removal loop the
+// engine uses keeps exactly the survivors
+
+#include "HostTest.h"
+#include "Pool.h"
+#include <algorithm>
+#include <vector>
+
+typedef Pool<int, 4> Small;
+
+static std::vector<int> items(const Small &pool) {
+  return std::vector<int>(pool.begin(), pool.end());
+}
+
+static void fill(Small &pool, std::initializer_list<int> values) {
+  for (int v : values)
+    *pool.spawn() = v;
+}
+
+static void testSwapRemove() {
+  Small pool;
+  CHECK(pool.empty());
+  fill(pool, {10, 11, 12, 13});
+  CHECK(items(pool) == std::vector<int>({10, 11, 12, 13}));
+
+  pool.remove(1); // The last one takes its slot
+  CHECK(items(pool) == std::vector<int>({10, 13, 12}));
+  pool.remove(2); // The last one itself: nothing moves
+  CHECK(items(pool) == std::vector<int>({10, 13}));
+  pool.remove(0);
+  CHECK(items(pool) == std::vector<int>({13}));
+  pool.remove(0);
+  CHECK(pool.empty());
+
+  // Spawns append after the survivors
+  fill(pool, {20, 21});
+  pool.remove(0);
+  *pool.spawn() = 22;
+  CHECK(items(pool) == std::vector<int>({21, 22}));
+}
+
+static void testFull() {
+  Small pool;
+  CHECK_EQ(Small::capacity(), 4);
+  fill(pool, {1, 2, 3, 4});
+  CHECK(pool.spawn() == nullptr);
+  CHECK(pool.spawn() == nullptr);
+  CHECK_EQ(pool.size(), 4);
+  CHECK_EQ(pool.dropped(), 2);
+  CHECK(items(pool) == std::vector<int>({1, 2, 3, 4})); // Left untouched
+
+  // Room again after a removal; the high-water mark stays at the peak
+  pool.remove(3);
+  CHECK(pool.spawn() != nullptr);
+  pool.clear();
+  CHECK(pool.empty());
+  CHECK_EQ(pool.highWater(), 4);
+  CHECK_EQ(pool.dropped(), 2);
+  CHECK(pool.spawn() != nullptr);
+}
+
+// As in updateBullets(): walking backwards, every item is visited once and
+// the removed ones are gone
+static void testRemoveWhileIterating() {
+  Pool<int, 32> pool;
+  for (int i = 0; i < 32; i++)
+    *pool.spawn() = i;
+  std::vector<int> seen;
+  for (int i = pool.size() - 1; i >= 0; i--) {
+    seen.push_back(pool[i]);
+    if (pool[i] % 3 != 1)
+      pool.remove(i);
+  }
+  std::sort(seen.begin(), seen.end());
+  CHECK_EQ(seen.size(), 32);
+  for (int i = 0; i < 32; i++)
+    CHECK_EQ(seen[i], i);
+
+  std::vector<int> left(pool.begin(), pool.end());
+  std::sort(left.begin(), left.end());
+  CHECK_EQ(left.size(), 11);
+  for (size_t i = 0; i < left.size(); i++)
+    CHECK_EQ(left[i], 3 * (int)i + 1);
+}
+
+int main() {
+  testSwapRemove();
+  testFull();
+  testRemoveWhileIterating();
+  return hostTestResult();
+}
@@ -0,0 +1,121 @@
+// drawRunSprite against plotting the same sprite pixel by pixel with
+// drawPixel, at positions clipped on every side of a band viewport, and how
+// long each takes
+
+#include "HostBoard.h"
+#include "HostTest.h"
+#include "Sprites.h"
+#include <algorithm>
+
+static const int WIDTH = 480;
+static const int BAND = 32;
+
+// The reference: every opaque pixel through drawPixel, which clips to the
+// viewport and stores panel byte order itself
+static void drawPerPixel(TFT_eSprite *dst, const RunSprite &s, int x, int y,
+                         const uint16_t *palette = nullptr) {
+  if (!palette)
+    palette = s.palette;
+  for (int row = 0; row < s.bh; row++) {
+    for (int r = s.rowStart[row]; r < s.rowStart[row + 1]; r++) {
+      const SpriteRun &run = s.runs[r];
+      for (int i = 0; i < run.len; i++) {
+        uint16_t c = palette[s.pixels[run.pixel + i]];
+        dst->drawPixel(x + s.ox + run.x + i, y + s.oy + row,
+                       (uint16_t)(c << 8 | c >> 8));
+      }
+    }
+  }
+}
+
+// Both ways into a strip of two bands, the second selected; background in
+// a pattern so transparent pixels show
+static int compare(TFT_eSprite &a, TFT_eSprite &b, const RunSprite &s, int x,
+                   int y, const uint16_t *palette = nullptr) {
+  uint16_t *pa = (uint16_t *)a.getPointer();
+  uint16_t *pb = (uint16_t *)b.getPointer();
+  for (int i = 0; i < WIDTH * BAND * 2; i++)
+    pa[i] = pb[i] = (uint16_t)(i * 2654435761u >> 16);
+  a.setViewport(0, BAND, WIDTH, BAND);
+  b.setViewport(0, BAND, WIDTH, BAND);
+  drawRunSprite(&a, s, x, y, palette);
+  drawPerPixel(&b, s, x, y, palette);
+  return memcmp(pa, pb, WIDTH * BAND * 2 * 2) != 0;
+}
+
+int main() {
+  TFT_eSPI tft;
+  TFT_eSprite a(&tft), b(&tft);
+  a.createSprite(WIDTH, BAND * 2);
+  b.createSprite(WIDTH, BAND * 2);
+
+  const RunSprite *sprites[] = {&boss_ship,         &bullet_sprite,
+                                &enemy_ship,        &explosion[0],
+                                &explosion[1],      &explosion[2],
+                                &explosion[3],      &player_ship,
+                                &player_ship_blue,  &player_ship_green,
+                                &player_ship_red,   &powerup_shield,
+                                &powerup_weapon};
+  int positions = 0;
+  for (const RunSprite *s : sprites) {
+    for (int y = -s->h - 1; y <= BAND + 1; y++) {
+      for (int x : {-s->w - 1, -s->w + 1, -s->w / 2, -1, 0, 1, 200,
+                    WIDTH - s->w, WIDTH - s->w / 2, WIDTH - 1, WIDTH}) {
+        int differs = compare(a, b, *s, x, y);
+        if (differs)
+          printf("%dx%d sprite differs at (%d, %d)\n", s->w, s->h, x, y);
+        CHECK_EQ(differs, 0);
+        positions++;
+      }
+    }
+  }
+
+  // Recoloured through another palette with the same layout
+  uint16_t palette[256];
+  for (int i = 0; i < 256; i++)
+    palette[i] = (uint16_t)(i * 257);
+  CHECK_EQ(compare(a, b, enemy_ship, 100, 4, palette), 0);
+
+  // Every opaque pixel goes through the palette given: one colour in all
+  // entries leaves exactly the sprite's opaque pixels in that colour
+  const uint16_t MARK = 0xBEEF;
+  for (int i = 0; i < 256; i++)
+    palette[i] = MARK;
+  a.resetViewport();
+  a.fillSprite(0);
+  a.setViewport(0, BAND, WIDTH, BAND);
+  drawRunSprite(&a, enemy_ship, 100, 4, palette);
+  int opaque = 0, marked = 0;
+  for (int r = 0; r < enemy_ship.rowStart[enemy_ship.bh]; r++)
+    opaque += enemy_ship.runs[r].len;
+  const uint16_t *pa = (const uint16_t *)a.getPointer();
+  for (int i = 0; i < WIDTH * BAND * 2; i++)
+    marked += pa[i] == MARK;
+  CHECK(opaque > 0);
+  CHECK_EQ(marked, opaque);
+  printf("%d positions compared\n", positions);
+
+  // Inside the band, so neither pays for clipping. Best of 7 rounds, the
+  // rest is scheduler noise.
+  //
+  // Runs come out about 4x ahead here. The fake drawPixel is a bare store,
+  // far cheaper than TFT_eSprite's on the board, so the device gains more.
+  // What is left per pixel is the palette lookup: pixels stay indices so a
+  // skin can swap palettes, which rules out memcpy'ing stored colours.
+  a.setViewport(0, BAND, WIDTH, BAND);
+  b.setViewport(0, BAND, WIDTH, BAND);
+  const int n = 20000;
+  double runsUs = 1e9, pixelsUs = 1e9;
+  for (int round = 0; round < 7; round++) {
+    runsUs = std::min(runsUs, benchmarkUs(n, [&] {
+      drawRunSprite(&a, enemy_ship, 200, 4);
+    }));
+    pixelsUs = std::min(pixelsUs, benchmarkUs(n, [&] {
+      drawPerPixel(&b, enemy_ship, 200, 4);
+    }));
+  }
+  printf("24x24 enemy: %.3f us with runs, %.3f us per pixel (%.1fx)\n",
+         runsUs, pixelsUs, pixelsUs / runsUs);
+  CHECK(pixelsUs / runsUs >= 3.0); // Margin below the ~4x reached
+  return hostTestResult();
+}
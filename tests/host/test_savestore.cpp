@@ -0,0 +1,147 @@
+// SaveStore against the fake Preferences: records survive a reboot, an
+// unchanged set() never reaches flash, a damaged or older record falls
+// back to the defaults, and PenaltyGame moves its old key over only once
+
+#include "GameEngine.h"
+#include "HostBoard.h"
+#include "HostTest.h"
+
+struct Record {
+  int32_t coins;
+  uint8_t skin;
+};
+
+typedef SaveStore<Record, 1> Store;
+
+// A fresh boot reading the namespace. False when no valid record was there.
+static bool boot(Store &store) { return store.begin("test"); }
+
+static void testWriteBehind() {
+  host::reset();
+  Store store;
+  CHECK(!boot(store)); // Nothing saved yet
+  CHECK_EQ(store.get().coins, 0);
+
+  // A missing record is written even when it is the default
+  store.flush();
+  CHECK_EQ(host::board().nvsWrites, 1);
+  CHECK(!store.dirty());
+  Store again;
+  CHECK(boot(again));
+
+  // Unchanged: marked nothing, writes nothing
+  store.set(Record{});
+  CHECK(!store.dirty());
+  store.flush();
+  store.flushIfDue(0);
+  CHECK_EQ(host::board().nvsWrites, 1);
+  CHECK_EQ(store.stats().flushes, 1);
+
+  // Changed twice, written once, and only once due
+  store.set({100, 2});
+  store.set({150, 2});
+  host::advance(1000000);
+  store.flushIfDue(2000);
+  CHECK_EQ(host::board().nvsWrites, 1);
+  host::advance(1000000);
+  store.flushIfDue(2000);
+  CHECK_EQ(host::board().nvsWrites, 2);
+  store.set({150, 2});
+  store.flush();
+  CHECK_EQ(host::board().nvsWrites, 2);
+
+  Store reboot;
+  CHECK(boot(reboot));
+  CHECK_EQ(reboot.get().coins, 150);
+  CHECK_EQ(reboot.get().skin, 2);
+  CHECK(!reboot.dirty());
+}
+
+static void testInvalid() {
+  host::reset();
+  Store store;
+  boot(store);
+  store.set({500, 3});
+  store.flush();
+
+  // One bit flipped in the stored record: the CRC no longer matches
+  Preferences prefs;
+  prefs.begin("test");
+  uint8_t blob[64];
+  size_t len = prefs.getBytes("save", blob, sizeof(blob));
+  CHECK(len > 8);
+  blob[8] ^= 0x10; // Low byte of coins
+  prefs.putBytes("save", blob, len);
+  Store corrupted;
+  CHECK(!boot(corrupted));
+  CHECK_EQ(corrupted.get().coins, 0);
+  CHECK_EQ(corrupted.get().skin, 0);
+  CHECK(corrupted.dirty()); // Rewritten at the next flush
+
+  // Repaired, then read by a newer save format
+  blob[8] ^= 0x10;
+  prefs.putBytes("save", blob, len);
+  Store repaired;
+  CHECK(boot(repaired));
+  CHECK_EQ(repaired.get().coins, 500);
+  SaveStore<Record, 2> newer;
+  CHECK(!newer.begin("test"));
+  CHECK_EQ(newer.get().coins, 0);
+
+  // Cut short
+  prefs.putBytes("save", blob, len - 1);
+  Store truncated;
+  CHECK(!boot(truncated));
+  CHECK_EQ(truncated.get().coins, 0);
+}
+
+// The high score PenaltyGame stored last, or -1 without a valid record
+static int savedHighScore() {
+  SaveStore<PenaltySave, 1> store;
+  return store.begin("penalty") ? store.get().highScore : -1;
+}
+
+static void testPenaltyMigration() {
+  TFT_eSPI tft;
+  Input input;
+  GameEngine engine(&tft, &input);
+
+  // The first version's key moves into the record and is removed
+  host::reset();
+  Preferences old;
+  old.begin("penalty");
+  old.putInt("highScore", 7);
+  uint32_t writes = host::board().nvsWrites;
+  engine.initSimulation();
+  CHECK_EQ(host::board().nvsWrites, writes + 1);
+  CHECK(!old.isKey("highScore"));
+  CHECK_EQ(savedHighScore(), 7);
+
+  // Migrated once: later boots read the record and write nothing
+  writes = host::board().nvsWrites;
+  engine.initSimulation();
+  engine.initSimulation();
+  CHECK_EQ(host::board().nvsWrites, writes);
+
+  // A high score of 0, the default, is stored all the same
+  host::reset();
+  old.putInt("highScore", 0);
+  engine.initSimulation();
+  CHECK_EQ(savedHighScore(), 0);
+  CHECK(!old.isKey("highScore"));
+  writes = host::board().nvsWrites;
+  engine.initSimulation();
+  CHECK_EQ(host::board().nvsWrites, writes);
+
+  // First boot ever: no key, a zeroed record
+  host::reset();
+  engine.initSimulation();
+  CHECK_EQ(savedHighScore(), 0);
+}
+
+int main() {
+  testWriteBehind();
+  testInvalid();
+  testPenaltyMigration();
+  return hostTestResult();
+}
@@ -0,0 +1,123 @@
+// Touch input against a fake FT6336 on the I2C bus: decodeTouch on the
+// register file, getTouch() polling it in one burst, and the INT-driven
+// path reading the panel only when it pulls INT low
+
+#include "HostBoard.h"
+#include "HostTest.h"
+#include "Input.h"
+
+static const int SCREEN_W = 480;
+static const int SCREEN_H = 320;
+
+// Point i down at panel (x, y): event flags and touch id in the high
+// nibbles, as the panel reports them
+static void press(int i, int x, int y) {
+  uint8_t *p = host::board().i2c.regs + FT6336_REG_STATUS + 1 + i * 6;
+  p[0] = 0x80 | x >> 8;
+  p[1] = x & 0xFF;
+  p[2] = i << 4 | y >> 8;
+  p[3] = y & 0xFF;
+}
+
+static void setTouches(uint8_t status) {
+  host::board().i2c.regs[FT6336_REG_STATUS] = status;
+}
+
+static TouchState decodeRegs() {
+  return decodeTouch(host::board().i2c.regs + FT6336_REG_STATUS);
+}
+
+static void testDecode() {
+  host::reset();
+  setTouches(0x0F); // Until the first scan after reset
+  press(0, 100, 200);
+  CHECK_EQ(decodeRegs().touches, 0);
+  setTouches(0);
+  CHECK_EQ(decodeRegs().touches, 0);
+
+  setTouches(1);
+  TouchState state = decodeRegs();
+  CHECK_EQ(state.touches, 1);
+  CHECK_EQ(state.x[0], 100);
+  CHECK_EQ(state.y[0], 200);
+
+  setTouches(2);
+  press(1, 319, 479);
+  state = decodeRegs();
+  CHECK_EQ(state.touches, 2);
+  CHECK_EQ(state.x[0], 100);
+  CHECK_EQ(state.x[1], 319);
+  CHECK_EQ(state.y[1], 479);
+}
+
+// Without tasks getTouch() falls back to polling, one burst per call
+static void testPolled() {
+  host::reset();
+  Input input;
+  input.begin();
+  host::I2cDevice &panel = host::board().i2c;
+
+  panel.transactions = 0;
+  setTouches(0);
+  CHECK(!input.getTouch(SCREEN_W, SCREEN_H).touched);
+  CHECK_EQ(panel.transactions, 2); // Register pointer, then the burst
+
+  setTouches(1);
+  press(0, 100, 200);
+  Point p = input.getTouch(SCREEN_W, SCREEN_H);
+  CHECK(p.touched);
+  CHECK_EQ(p.x, SCREEN_W - 200); // Panel is mounted rotated
+  CHECK_EQ(p.y, 100);
+  CHECK_EQ(panel.transactions, 4);
+
+  panel.present = false;
+  CHECK(!input.getTouch(SCREEN_W, SCREEN_H).touched);
+}
+
+// With tasks the bus is read once per INT pulse, whatever the callers do
+static void testInterruptDriven() {
+  host::reset();
+  host::board().tasks = true;
+  Input input;
+  input.begin();
+  host::I2cDevice &panel = host::board().i2c;
+  panel.transactions = 0;
+
+  // Idle: no edge, no bus traffic however often it is asked
+  for (int i = 0; i < 100; i++) {
+    host::advance(1000);
+    CHECK(!input.getTouch(SCREEN_W, SCREEN_H).touched);
+  }
+  CHECK_EQ(panel.transactions, 0);
+
+  // The panel pulls INT low with a reading ready
+  setTouches(1);
+  press(0, 100, 200);
+  uint64_t edge = host::board().now;
+  host::setPin(TOUCH_INT, LOW);
+  host::advance(100);
+  host::setPin(TOUCH_INT, HIGH);
+  for (int i = 0; i < 10; i++) {
+    Point p = input.getTouch(SCREEN_W, SCREEN_H);
+    CHECK(p.touched);
+    CHECK_EQ(p.x, SCREEN_W - 200);
+    CHECK_EQ(p.y, 100);
+  }
+  CHECK_EQ(input.getTouchTime(), edge);
+  CHECK_EQ(panel.transactions, 2);
+
+  // Release with its pulse missed: caught by the 50 ms timeout
+  setTouches(0);
+  host::advance(60000);
+  CHECK(!input.getTouch(SCREEN_W, SCREEN_H).touched);
+  CHECK_EQ(panel.transactions, 4);
+  host::advance(100000);
+  CHECK_EQ(panel.transactions, 4); // Asleep again until the next edge
+}
+
+int main() {
+  testDecode();
+  testPolled();
+  testInterruptDriven();
+  return hostTestResult();
+}
@@ -0,0 +1,62 @@
+// TripleBuffer with a real writer and reader thread, as between the
+// simulation and render cores: every value read is complete, values only
+// move forward and the front slot holds still until the next acquire()
+
+#include "HostTest.h"
+#include "TripleBuffer.h"
+#include <thread>
+
+// About the size of a game's RenderState, every word set to the tick number
+struct Snapshot {
+  uint32_t words[256];
+};
+
+static bool complete(const Snapshot &s) {
+  for (uint32_t w : s.words)
+    if (w != s.words[0])
+      return false;
+  return true;
+}
+
+int main() {
+  const uint32_t ticks = 200000;
+  TripleBuffer<Snapshot> buffer;
+
+  std::thread simulation([&] {
+    for (uint32_t tick = 1; tick <= ticks; tick++) {
+      Snapshot &s = buffer.back();
+      for (uint32_t &w : s.words)
+        w = tick;
+      buffer.publish();
+      if (tick % 4 == 0)
+        std::this_thread::yield(); // Let a single-core host read too
+    }
+  });
+
+  // Ends on the last tick: the last value published is never dropped
+  uint32_t last = 0, reads = 0, torn = 0, backwards = 0, moved = 0;
+  while (last < ticks) {
+    if (!buffer.acquire()) {
+      std::this_thread::yield();
+      continue;
+    }
+    const Snapshot &s = buffer.front();
+    torn += !complete(s);
+    backwards += s.words[0] <= last;
+    last = s.words[0];
+    reads++;
+    // Every so often hold the frame while the writer keeps publishing
+    if (reads % 64 == 0) {
+      for (int i = 0; i < 100; i++)
+        std::this_thread::yield();
+      moved += s.words[0] != last || !complete(s);
+    }
+  }
+  simulation.join();
+
+  printf("%u of %u snapshots read\n", reads, ticks);
+  CHECK_EQ(torn, 0);
+  CHECK_EQ(backwards, 0);
+  CHECK_EQ(moved, 0);
+  return hostTestResult();
+}
@@ -0,0 +1,344 @@
+"""
+Sprite compiler: turns PNG sprites into run-encoded, palette-indexed C++
+headers.
+
+Each PNG is trimmed to its opaque bounding box, split into horizontal runs
+of opaque pixels and emitted as constexpr RunSprite tables (see
+RunSprite.h). Pixels are 8-bit indices into a palette of up to 256 RGB565
+colours (panel byte order) per PNG; all frames of a sheet share it. The
+engine looks each index up while copying a run, and can pass another
+palette of the same layout to recolour a sprite.
+
+Usage:
+    python3 tools/sprite_compiler.py -o SpaceShooter/Sprites.h SpaceShooter/sprites/*.png
+
+File names give the C++ names:
+    enemy_ship.png          -> constexpr RunSprite enemy_ship
+    explosion.16x16.png     -> constexpr RunSprite explosion[N], one per
+                               16x16 frame, left to right, top to bottom
+
+Pixels with alpha < 128 are transparent. --key RRGGBB adds a colour key for
+images without alpha. Identical frames share their tables, identical
+palettes are emitted once and repeated index sequences share the same slice
+of the pixel pool.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+SHEET_NAME = re.compile(r"^([A-Za-z_][A-Za-z0-9_]*)\.(\d+)x(\d+)$")
+PLAIN_NAME = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
+
+
+# ============= PNG DECODING =============
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def unfilter(data, width, height, bpp):
+    stride = width * bpp
+    out = bytearray(stride * height)
+    prev = bytearray(stride)
+    pos = 0
+    for y in range(height):
+        ftype = data[pos]
+        line = bytearray(data[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                line[i] = (line[i] + paeth(a, b, c)) & 0xFF
+            elif ftype != 0:
+                raise ValueError("unknown PNG filter %d" % ftype)
+        out[y * stride:(y + 1) * stride] = line
+        prev = line
+    return out
+
+
+def read_png(path):
+    """Returns (width, height, pixels) with pixels as (r, g, b, a) tuples."""
+    with open(path, "rb") as f:
+        blob = f.read()
+    if blob[:8] != PNG_SIGNATURE:
+        raise ValueError("not a PNG file")
+
+    pos = 8
+    idat = b""
+    palette = []
+    trns = b""
+    header = None
+    while pos < len(blob):
+        length, kind = struct.unpack(">I4s", blob[pos:pos + 8])
+        chunk = blob[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, length, 3)]
+        elif kind == b"tRNS":
+            trns = chunk
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+
+    width, height, depth, ctype, _, _, interlace = header
+    if depth != 8 or interlace != 0:
+        raise ValueError("only 8-bit, non-interlaced PNGs are supported")
+    bpp = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(ctype)
+    if bpp is None:
+        raise ValueError("unsupported PNG colour type %d" % ctype)
+
+    raw = unfilter(zlib.decompress(idat), width, height, bpp)
+    pixels = []
+    for i in range(0, len(raw), bpp):
+        px = raw[i:i + bpp]
+        if ctype == 6:
+            pixels.append(tuple(px))
+        elif ctype == 2:
+            pixels.append((px[0], px[1], px[2], 255))
+        elif ctype == 3:
+            alpha = trns[px[0]] if px[0] < len(trns) else 255
+            pixels.append(palette[px[0]] + (alpha,))
+        elif ctype == 4:
+            pixels.append((px[0], px[0], px[0], px[1]))
+        else:
+            pixels.append((px[0], px[0], px[0], 255))
+    return width, height, pixels
+
+
+# ============= ENCODING =============
+
+def rgb565_swapped(r, g, b):
+    color = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+    return ((color & 0xFF) << 8) | (color >> 8)
+
+
+class Frame:
+    def __init__(self, w, h, cells):
+        """cells: row-major list of palette indices or None."""
+        self.w, self.h = w, h
+        opaque = [(x, y) for y in range(h) for x in range(w)
+                  if cells[y * w + x] is not None]
+        if not opaque:
+            self.ox = self.oy = self.bw = self.bh = 0
+            self.rows = []
+            return
+        self.ox = min(x for x, _ in opaque)
+        self.oy = min(y for _, y in opaque)
+        self.bw = max(x for x, _ in opaque) - self.ox + 1
+        self.bh = max(y for _, y in opaque) - self.oy + 1
+
+        # Runs per trimmed row: (x, [pixels])
+        self.rows = []
+        for y in range(self.oy, self.oy + self.bh):
+            runs = []
+            x = self.ox
+            while x < self.ox + self.bw:
+                if cells[y * w + x] is None:
+                    x += 1
+                    continue
+                start = x
+                while (x < self.ox + self.bw and x - start < 255 and
+                       cells[y * w + x] is not None):
+                    x += 1
+                runs.append((start - self.ox,
+                             [cells[y * w + i] for i in range(start, x)]))
+            self.rows.append(runs)
+
+    def key(self):
+        return (self.w, self.h, self.ox, self.oy, self.bw, self.bh,
+                tuple((x, tuple(p)) for row in self.rows for x, p in row),
+                tuple(len(row) for row in self.rows))
+
+
+class PixelPool:
+    """Shared pixel table; repeated sequences reuse an existing slice."""
+
+    def __init__(self):
+        self.data = []
+
+    def add(self, seq):
+        n = len(seq)
+        for i in range(len(self.data) - n + 1):
+            if self.data[i:i + n] == seq:
+                return i
+        self.data.extend(seq)
+        return len(self.data) - n
+
+
+def load_frames(path, key):
+    """Returns (name, is_sheet, frames, palette)."""
+    width, height, pixels = read_png(path)
+    palette = []
+    index = {}
+    cells = []
+    for r, g, b, a in pixels:
+        if a < 128 or (key is not None and (r, g, b) == key):
+            cells.append(None)
+            continue
+        color = rgb565_swapped(r, g, b)
+        if color not in index:
+            index[color] = len(palette)
+            palette.append(color)
+        cells.append(index[color])
+    if len(palette) > 256:
+        raise ValueError("%d colours, an 8-bit palette holds 256" %
+                         len(palette))
+
+    stem = os.path.splitext(os.path.basename(path))[0]
+    sheet = SHEET_NAME.match(stem)
+    if not sheet:
+        if not PLAIN_NAME.match(stem):
+            raise ValueError("file name is not a valid C++ identifier")
+        return stem, False, [Frame(width, height, cells)], palette
+
+    name, fw, fh = sheet.group(1), int(sheet.group(2)), int(sheet.group(3))
+    if width % fw or height % fh:
+        raise ValueError("image is not a whole number of %dx%d frames" %
+                         (fw, fh))
+    frames = []
+    for fy in range(0, height, fh):
+        for fx in range(0, width, fw):
+            sub = [cells[(fy + y) * width + fx + x]
+                   for y in range(fh) for x in range(fw)]
+            frames.append(Frame(fw, fh, sub))
+    return name, True, frames, palette
+
+
+# ============= OUTPUT =============
+
+def format_table(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt(v) for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def compile_sprites(paths, out_path, key):
+    guard = re.sub(r"\W", "_", os.path.basename(out_path)).upper()
+    prefix = re.sub(r"\W", "_", os.path.splitext(
+        os.path.basename(out_path))[0]).lower()
+    pool = PixelPool()
+    tables = {}     # Frame.key() -> table name
+    palettes = {}   # Palette tuple -> table name
+    body = []
+    sprites = []
+    total_before = 0
+
+    for path in sorted(paths):
+        try:
+            name, is_sheet, frames, palette = load_frames(path, key)
+        except (ValueError, OSError) as e:
+            sys.exit("%s: %s" % (path, e))
+
+        palette_table = palettes.get(tuple(palette))
+        if palette_table is None:
+            palette_table = name + "_palette"
+            palettes[tuple(palette)] = palette_table
+            body.append("// %s: %d colours" % (palette_table, len(palette)))
+            body.append("constexpr uint16_t %s[] = {\n%s};\n" %
+                        (palette_table, format_table(
+                            palette, 8, lambda v: "0x%04x" % v) or "    0"))
+
+        inits = []
+        for i, frame in enumerate(frames):
+            table = tables.get(frame.key())
+            if table is None:
+                table = name + ("_%d" % i if is_sheet else "")
+                tables[frame.key()] = table
+                row_start = [0]
+                runs = []
+                for row in frame.rows:
+                    for x, seq in row:
+                        runs.append((x, len(seq), pool.add(seq)))
+                    row_start.append(len(runs))
+                if len(pool.data) > 0xFFFF or len(runs) > 0xFFFF:
+                    sys.exit("%s: sprite data exceeds 16-bit indices" % path)
+
+                body.append("// %s: %dx%d, opaque %dx%d at (%d, %d), %d runs" %
+                            (table, frame.w, frame.h, frame.bw, frame.bh,
+                             frame.ox, frame.oy, len(runs)))
+                body.append("constexpr uint16_t %s_rows[] = {\n%s};" %
+                            (table, format_table(row_start, 12, str)))
+                body.append("constexpr SpriteRun %s_runs[] = {\n%s};\n" %
+                            (table, format_table(
+                                runs, 4, lambda r: "{%d, %d, %d}" % r) or
+                             "    {0, 0, 0}"))
+            total_before += frame.w * frame.h
+            inits.append("{%d, %d, %d, %d, %d, %d, %s_rows, %s_runs, "
+                         "%s_pixels, %s}" % (frame.w, frame.h, frame.ox,
+                                             frame.oy, frame.bw, frame.bh,
+                                             table, table, prefix,
+                                             palette_table))
+
+        if is_sheet:
+            sprites.append("constexpr RunSprite %s[%d] = {\n    %s};" %
+                           (name, len(inits), ",\n    ".join(inits)))
+        else:
+            sprites.append("constexpr RunSprite %s = %s;" % (name, inits[0]))
+
+    sources = " ".join(os.path.basename(p) for p in sorted(paths))
+    out = []
+    out.append("// Generated by tools/sprite_compiler.py - do not edit.")
+    out.append("// Sources: %s" % sources)
+    out.append("// Pixels: %d stored of %d in the source frames, %d "
+               "palette entries" % (len(pool.data), total_before,
+                                    sum(len(p) for p in palettes)))
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s\n" % guard)
+    out.append('#include "RunSprite.h"\n')
+    out.append("// Opaque pixels as indices into each sprite's palette")
+    out.append("constexpr uint8_t %s_pixels[] = {\n%s};\n" %
+               (prefix, format_table(pool.data, 16, str) or "    0"))
+    out.extend(body)
+    out.extend(sprites)
+    out.append("\n#endif")
+
+    text = "\n".join(out) + "\n"
+    old = None
+    if os.path.exists(out_path):
+        with open(out_path) as f:
+            old = f.read()
+    if old != text:
+        with open(out_path, "w") as f:
+            f.write(text)
+    print("%s: %d sprite(s), %d of %d pixels kept (%d runs tables)" %
+          (out_path, len(sprites), len(pool.data), total_before, len(tables)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("-o", "--output", required=True,
+                        help="generated header")
+    parser.add_argument("--key", help="transparent colour as RRGGBB")
+    parser.add_argument("pngs", nargs="+")
+    args = parser.parse_args()
+
+    key = None
+    if args.key:
+        value = int(args.key, 16)
+        key = ((value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF)
+    compile_sprites(args.pngs, args.output, key)
+
+
+if __name__ == "__main__":
+    main()